@@ -1,295 +1,516 @@
-// AC3DVOSolver.cpp
-#include "AC3DVOSolver.h"
-#include <cmath>
-#include <queue>
-
-AC3DVOSolver::AC3DVOSolver(int boardSize, const Solution &initial, int maxDepth, std::queue<Solution> *wq, std::mutex *qm)
-    : n(boardSize), initialState(initial), foundFirst(false), maxDepth(maxDepth), workQueue(wq), queueMutex(qm)
-{
-    precomputeAttackMasks();
-}
-
-void AC3DVOSolver::precomputeAttackMasks()
-{
-    // we're only computing attackMask once, then resuing it per check
-    // attackMask[r1][r2][col] = bitmask of columns in r2 attacked by queen at (r1, col)
-    attackMask.resize(n, std::vector<std::vector<uint64_t>>(n, std::vector<uint64_t>(n, 0)));
-
-    for (int r1 = 0; r1 < n; r1++)
-    {
-        for (int r2 = 0; r2 < n; r2++)
-        {
-            if (r1 == r2)
-                continue;
-
-            for (int col = 0; col < n; col++)
-            {
-                uint64_t mask = 0;
-
-                // column
-                mask |= (1ULL << col);
-
-                // diagonals
-                int diagDist = abs(r2 - r1);
-                if (col + diagDist < n)
-                    mask |= (1ULL << (col + diagDist));
-                if (col - diagDist >= 0)
-                    mask |= (1ULL << (col - diagDist));
-
-                attackMask[r1][r2][col] = mask;
-            }
-        }
-    }
-}
-
-// we could have just used this https://www.geeksforgeeks.org/cpp/cpp-__builtin_popcount-function/
-inline int AC3DVOSolver::popcount(uint64_t x) const
-{
-    int count = 0;
-    while (x)
-    {
-        count++;
-        x &= x - 1;
-    }
-    return count;
-}
-
-std::vector<uint64_t> AC3DVOSolver::initializeDomains(const Solution &board) const
-{
-    // start with all columns available
-    std::vector<uint64_t> domains(n, (1ULL << n) - 1);
-
-    // then remove attacked columns based on already-assigned queens
-    for (int row = 0; row < n; row++)
-    {
-        if (board[row] != -1)
-        {
-            int col = board[row];
-            domains[row] = 0; // set row as assigned
-
-            // remove columns attacked by this queen using precomputed mask
-            for (int otherRow = 0; otherRow < n; otherRow++)
-            {
-                if (otherRow != row)
-                {
-                    // available &= ~attackMask[prevRow][row][prevCol];
-                    domains[otherRow] &= ~attackMask[row][otherRow][col];
-                }
-            }
-        }
-    }
-
-    return domains;
-}
-
-// checks whether row1 is arc consistent with row2, nothing else
-inline bool AC3DVOSolver::revise(int row1, int row2, std::vector<uint64_t> &domains, const Solution &board) const
-{
-    if (board[row1] != -1 || board[row2] != -1)
-        return false;
-
-    uint64_t domain1 = domains[row1];
-    uint64_t domain2 = domains[row2];
-    uint64_t toRemove = 0;
-
-    // for each value in row1's domain, check if there's support in row2
-    uint64_t testDomain = domain1;
-    while (testDomain)
-    {
-        // get next set bit
-        // int col1 = __builtin_ctzll(testDomain);
-        int col1 = __builtin_ctzll(testDomain);
-
-        // clear lowest set bit
-        testDomain &= testDomain - 1;
-
-        // check if row2 has ANY value compatible with (row1, col1)
-        // can be found by doman2 minus values attacked by (row1, col1)
-        uint64_t compatible = domain2 & ~attackMask[row1][row2][col1];
-
-        if (compatible == 0)
-        {
-            // meant that there is no support for col1 in row1
-            toRemove |= (1ULL << col1);
-        }
-    }
-
-    // if there has been a removal, return true to indicate dirty, and enforce has to readd
-    if (toRemove)
-    {
-        domains[row1] &= ~toRemove;
-        return true;
-    }
-
-    // no revisions
-    return false;
-}
-
-bool AC3DVOSolver::enforceArcConsistency(std::vector<uint64_t> &domains, const Solution &board) const
-{
-    std::queue<std::pair<int, int>> worklist;
-
-    // build initial worklist of only unassigned rows
-    for (int i = 0; i < n; i++)
-    {
-        if (board[i] != -1)
-            continue;
-        for (int j = 0; j < n; j++)
-        {
-            if (i != j && board[j] == -1)
-            {
-                worklist.push({i, j});
-            }
-        }
-    }
-
-    while (!worklist.empty())
-    {
-        // pop an arc
-        auto [row1, row2] = worklist.front();
-        worklist.pop();
-
-        // if something changes, like a domain gets pruned
-        if (revise(row1, row2, domains, board))
-        {
-            // if there is no remaining options for row1
-            if (domains[row1] == 0)
-            {
-                return false; // domain wipeout, this timeline is a deadend
-            }
-
-            // add arcs represented by (k, row1) foreach unassigned k != row2
-            // aka, re add all arcs pointing to row1 to reevaluate, except row2 since we just did that
-            for (int k = 0; k < n; k++)
-            {
-                if (k != row1 && k != row2 && board[k] == -1)
-                {
-                    worklist.push({k, row1});
-                }
-            }
-        }
-    }
-
-    // only complete when work queue is empty, and
-    return true;
-}
-
-int AC3DVOSolver::selectMRVRow(const Solution &board, const std::vector<uint64_t> &domains) const
-{
-    int bestRow = -1;
-    int minDomainSize = n + 1;
-
-    // already assigned
-    for (int row = 0; row < n; row++)
-    {
-        if (board[row] != -1)
-            continue;
-
-        int domainSize = popcount(domains[row]);
-
-        if (domainSize < minDomainSize)
-        {
-            minDomainSize = domainSize;
-            bestRow = row;
-        }
-    }
-
-    return bestRow;
-}
-
-int AC3DVOSolver::countAssigned(const Solution &board) const
-{
-    int count = 0;
-    for (int i = 0; i < n; i++)
-    {
-        if (board[i] != -1)
-            count++;
-    }
-    return count;
-}
-
-void AC3DVOSolver::solve()
-{
-    std::stack<AC3DVOSearchState> stateStack;
-
-    // initialize domains for all unassigned rows
-    std::vector<uint64_t> initialDomains = initializeDomains(initialState);
-
-    stateStack.push(AC3DVOSearchState(initialState, initialDomains));
-
-    while (!stateStack.empty())
-    {
-        AC3DVOSearchState current = stateStack.top();
-        stateStack.pop();
-
-        // if maxDepth is set and we've reached it, add to work queue instead of continuing
-        // this is only used for the seed generator solver
-        if (maxDepth > 0 && countAssigned(current.board) == maxDepth)
-        {
-            std::lock_guard<std::mutex> lock(*queueMutex);
-            workQueue->push(current.board);
-            continue;
-        }
-
-        // if solution is found
-        if (countAssigned(current.board) == n)
-        {
-            solutions.push_back(current.board);
-
-            if (!foundFirst)
-            {
-                firstSolutionTime = std::chrono::high_resolution_clock::now();
-                foundFirst = true;
-            }
-            continue;
-        }
-
-        // select row with mrv left
-        int row = selectMRVRow(current.board, current.domains);
-
-        if (row == -1)
-            continue; // no valid row, but like, this shouldnt happen?
-
-        uint64_t domain = current.domains[row];
-
-        for (int col = 0; col < n; col++)
-        {
-            if (!(domain & (1ULL << col)))
-                continue; // this value is not in domain
-
-            // create new state with updated domains
-            std::vector<uint64_t> newDomains = current.domains;
-
-            // mark this row as assigned
-            newDomains[row] = 0;
-
-            // remove columns attacked by (row, col) using precomputed mask
-            for (int otherRow = 0; otherRow < n; otherRow++)
-            {
-                if (otherRow != row)
-                {
-                    newDomains[otherRow] &= ~attackMask[row][otherRow][col];
-                }
-            }
-
-            Solution newBoard = current.board;
-            newBoard[row] = col;
-
-            // enforce arc consistency
-            if (enforceArcConsistency(newDomains, newBoard))
-            {
-                stateStack.push(AC3DVOSearchState(newBoard, newDomains));
-            }
-        }
-    }
-}
-
-const std::vector<Solution> &AC3DVOSolver::getSolutions() const
-{
-    return solutions;
-}
-
-std::chrono::high_resolution_clock::time_point AC3DVOSolver::getFirstSolutionTime() const
-{
-    return firstSolutionTime;
-}
\ No newline at end of file
+// AC3DVOSolver.cpp
+#include "AC3DVOSolver.h"
+#include <cmath>
+
+template <typename Domain, int FixedN>
+AC3DVOSolver<Domain, FixedN>::AC3DVOSolver(int boardSize, const Solution &initial, int maxDepth, std::queue<Solution> *wq, std::mutex *qm, bool countOnly, SolutionBatch *batch, SearchLimit *limit, WorkSplitter *splitter, bool useTrail, bool queensRevise, ArcOrder arcOrder)
+    : BoardSize<FixedN>(boardSize), initialState(initial), foundFirst(false), maxDepth(maxDepth), workQueue(wq), queueMutex(qm), countOnly(countOnly), solutionCount(0), batch(batch), limit(limit), splitter(splitter), useTrail(useTrail), queensRevise(queensRevise), arcs(boardSize, arcOrder),
+      attacks(FixedN > 0 ? nullptr : AttackTable<Domain>::get(boardSize)) {}
+
+template <typename Domain, int FixedN>
+void AC3DVOSolver<Domain, FixedN>::reset(const Solution &initial)
+{
+    initialState = initial;
+    solutions.clear();
+    solutionCount = 0;
+    foundFirst = false;
+    stats.clear();
+}
+
+template <typename Domain, int FixedN>
+typename AC3DVOSolver<Domain, FixedN>::Domains AC3DVOSolver<Domain, FixedN>::initializeDomains(const Solution &board) const
+{
+    // start with all columns available
+    Domains domains = makeRowArray<Domain, FixedN>(n, Domain::firstN(n));
+
+    // then remove attacked columns based on already-assigned queens
+    for (int row = 0; row < n; row++)
+    {
+        if (board[row] != -1)
+        {
+            int col = board[row];
+            domains[row] = Domain(); // set row as assigned
+
+            // remove columns attacked by this queen using precomputed mask
+            for (int otherRow = 0; otherRow < n; otherRow++)
+            {
+                if (otherRow != row)
+                {
+                    // available &= ~attackMask(prevRow, row, prevCol);
+                    domains[otherRow] &= ~attackMask(row, otherRow, col);
+                }
+            }
+        }
+    }
+
+    return domains;
+}
+
+// checks whether row1 is arc consistent with row2, nothing else
+template <typename Domain, int FixedN>
+inline bool AC3DVOSolver<Domain, FixedN>::revise(int row1, int row2, Domains &domains, const Board &board, Trail<Domain> *trail) const
+{
+    if (board[row1] != -1 || board[row2] != -1)
+        return false;
+
+    Domain domain1 = domains[row1];
+    Domain domain2 = domains[row2];
+    Domain toRemove;
+
+    if (queensRevise)
+    {
+        // a queen at (row1, col1) only rules out col1 and col1 +- distance in row2, so col1 can only lose
+        // its support when row2 has at most 3 values left and col1 attacks all of them
+        if (domain2.count() > 3)
+            return false;
+
+        // attacks are symmetric, so the unsupported values of row1 are the ones every value of row2 attacks back
+        toRemove = domain1;
+        Domain supports = domain2;
+        while (supports.any())
+        {
+            toRemove &= attackMask(row2, row1, supports.lowest());
+            supports.clearLowest();
+        }
+    }
+    else
+    {
+        // for each value in row1's domain, check if there's support in row2
+        Domain testDomain = domain1;
+        while (testDomain.any())
+        {
+            // get next set bit
+            int col1 = testDomain.lowest();
+
+            // clear lowest set bit
+            testDomain.clearLowest();
+
+            // check if row2 has ANY value compatible with (row1, col1)
+            // can be found by doman2 minus values attacked by (row1, col1)
+            Domain compatible = domain2 & ~attackMask(row1, row2, col1);
+
+            if (compatible.none())
+            {
+                // meant that there is no support for col1 in row1
+                toRemove.set(col1);
+            }
+        }
+    }
+
+    // if there has been a removal, return true to indicate dirty, and enforce has to readd
+    if (toRemove.any())
+    {
+        if (trail)
+            trail->save(row1, domains[row1]);
+        domains[row1] &= ~toRemove;
+        return true;
+    }
+
+    // no revisions
+    return false;
+}
+
+// domains are expected to be arc consistent apart from the rows in changedRows, so only arcs pointing
+// at those rows are queued to start with (pass every row to make a fresh state consistent)
+template <typename Domain, int FixedN>
+bool AC3DVOSolver<Domain, FixedN>::enforceArcConsistency(Domains &domains, const Board &board, const Domain &changedRows, Trail<Domain> *trail)
+{
+    // build initial worklist of only unassigned rows
+    for (int row1 = 0; row1 < n; row1++)
+    {
+        if (board[row1] != -1)
+            continue;
+
+        Domain changed = changedRows;
+        while (changed.any())
+        {
+            int row2 = changed.lowest();
+            changed.clearLowest();
+
+            if (row1 != row2 && board[row2] == -1)
+            {
+                arcs.push(row1, row2, arcs.prioritized() ? domains[row2].count() : 0);
+                stats.arcPush();
+            }
+        }
+    }
+
+    while (!arcs.empty())
+    {
+        // pop an arc
+        auto [row1, row2] = arcs.pop();
+        stats.revise();
+
+        // if something changes, like a domain gets pruned
+        if (revise(row1, row2, domains, board, trail))
+        {
+            // if there is no remaining options for row1
+            if (domains[row1].none())
+            {
+                arcs.clear();
+                stats.wipeout();
+                return false; // domain wipeout, this timeline is a deadend
+            }
+
+            // add arcs represented by (k, row1) foreach unassigned k != row2
+            // aka, re add all arcs pointing to row1 to reevaluate, except row2 since we just did that
+            int row1Size = arcs.prioritized() ? domains[row1].count() : 0;
+            for (int k = 0; k < n; k++)
+            {
+                if (k != row1 && k != row2 && board[k] == -1)
+                {
+                    arcs.push(k, row1, row1Size);
+                    stats.arcPush();
+                }
+            }
+        }
+    }
+
+    // only complete when work queue is empty, and
+    return true;
+}
+
+template <typename Domain, int FixedN>
+int AC3DVOSolver<Domain, FixedN>::selectMRVRow(const Board &board, const Domains &domains) const
+{
+    int bestRow = -1;
+    int minDomainSize = n + 1;
+
+    // already assigned
+    for (int row = 0; row < n; row++)
+    {
+        if (board[row] != -1)
+            continue;
+
+        int domainSize = domains[row].count();
+
+        if (domainSize < minDomainSize)
+        {
+            minDomainSize = domainSize;
+            bestRow = row;
+        }
+    }
+
+    return bestRow;
+}
+
+template <typename Domain, int FixedN>
+int AC3DVOSolver<Domain, FixedN>::countAssigned(const Board &board) const
+{
+    int count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (board[i] != -1)
+            count++;
+    }
+    return count;
+}
+
+// pushes a seed or records a solution once enough rows are assigned, true if it did either
+template <typename Domain, int FixedN>
+bool AC3DVOSolver<Domain, FixedN>::handleLeaf(const Board &board, int assigned)
+{
+    // if maxDepth is set and we've reached it, add to work queue instead of continuing
+    // this is only used for the seed generator solver
+    if (maxDepth > 0 && assigned == maxDepth)
+    {
+        std::lock_guard<std::mutex> lock(*queueMutex);
+        workQueue->push(toSolution(board));
+        return true;
+    }
+
+    // if solution is found
+    if (assigned == n)
+    {
+        // k solutions are already in (maybe from another thread), this one doesn't count
+        if (limit && !limit->claim(board))
+            return true;
+
+        solutionCount++;
+        if (batch)
+            batch->add(board);
+        else if (!countOnly)
+            solutions.push_back(toSolution(board));
+
+        if (!foundFirst)
+        {
+            firstSolutionTime = std::chrono::high_resolution_clock::now();
+            foundFirst = true;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// same search as solve(), but on a single board + domain array
+// every child prunes in place and logs what it changed, backtracking undoes the trail back to the frame's mark
+template <typename Domain, int FixedN>
+void AC3DVOSolver<Domain, FixedN>::solveInPlace()
+{
+    Domains domains = initializeDomains(initialState);
+    Board board = makeBoard<FixedN>(initialState);
+
+    // make the root arc consistent once, after that a node only propagates from the rows its assignment pruned
+    if (!enforceArcConsistency(domains, board, Domain::firstN(n)))
+        return;
+
+    // frames.size() is how many rows we assigned on top of the initial state
+    int initialAssigned = countAssigned(board);
+    trail.clear();
+    frames.clear();
+    frames.reserve(n);
+
+    if (handleLeaf(board, initialAssigned))
+        return;
+
+    // select row with mrv left
+    int firstRow = selectMRVRow(board, domains);
+    if (firstRow == -1)
+        return;
+
+    frames.push_back(TrailFrame<Domain>{firstRow, domains[firstRow], trail.mark()});
+    stats.node(initialAssigned);
+
+    while (!frames.empty())
+    {
+        // another solver claimed the k-th solution, stop here
+        if (limit && limit->stopped())
+            break;
+
+        // an idle worker needs work, hand it the next value of the shallowest frame that has one left
+        // (the last frame is the one being searched, every frame above it still has pending values)
+        if (splitter && frames.size() > 1 && splitter->wanted())
+        {
+            for (size_t i = 0; i + 1 < frames.size(); i++)
+            {
+                TrailFrame<Domain> &pending = frames[i];
+                if (pending.remaining.none())
+                    continue;
+                if (!splitter->worthSplitting(n - initialAssigned - static_cast<int>(i) - 1))
+                    break;
+
+                // the seed is the path down to this frame plus the donated value
+                Solution seed = initialState;
+                for (size_t above = 0; above < i; above++)
+                    seed[frames[above].row] = board[frames[above].row];
+                seed[pending.row] = pending.remaining.lowest();
+                pending.remaining.clearLowest();
+
+                splitter->donate(seed);
+                break;
+            }
+        }
+
+        TrailFrame<Domain> &frame = frames.back();
+        int row = frame.row;
+
+        // undo whatever the previously tried value of this row pruned
+        trail.undo(domains, frame.trailMark);
+
+        if (frame.remaining.none())
+        {
+            board[row] = -1;
+            frames.pop_back();
+            continue;
+        }
+
+        int col = frame.remaining.lowest();
+        frame.remaining.clearLowest();
+
+        // mark this row as assigned
+        trail.save(row, domains[row]);
+        domains[row] = Domain();
+
+        // remove columns attacked by (row, col) using precomputed mask, only logging domains that change
+        Domain changedRows;
+        for (int otherRow = 0; otherRow < n; otherRow++)
+        {
+            if (otherRow == row)
+                continue;
+
+            Domain pruned = domains[otherRow] & ~attackMask(row, otherRow, col);
+            if (pruned != domains[otherRow])
+            {
+                trail.save(otherRow, domains[otherRow]);
+                domains[otherRow] = pruned;
+                changedRows.set(otherRow);
+            }
+        }
+
+        board[row] = col;
+
+        // enforce arc consistency, a wipeout gets undone when we come back to this frame
+        if (!enforceArcConsistency(domains, board, changedRows, &trail))
+        {
+            stats.prune();
+            continue;
+        }
+
+        if (handleLeaf(board, initialAssigned + static_cast<int>(frames.size())))
+            continue;
+
+        int nextRow = selectMRVRow(board, domains);
+        if (nextRow == -1)
+            continue; // no valid row, but like, this shouldnt happen?
+
+        frames.push_back(TrailFrame<Domain>{nextRow, domains[nextRow], trail.mark()});
+        stats.node(initialAssigned + static_cast<int>(frames.size()) - 1);
+        stats.stack(frames.size());
+    }
+}
+
+template <typename Domain, int FixedN>
+void AC3DVOSolver<Domain, FixedN>::solve()
+{
+    if (useTrail)
+    {
+        solveInPlace();
+        return;
+    }
+
+    std::deque<AC3DVOSearchState<Domain, FixedN>> stateStack;
+
+    // initialize domains for all unassigned rows
+    Domains initialDomains = initializeDomains(initialState);
+    Board initialBoard = makeBoard<FixedN>(initialState);
+
+    // make the root arc consistent once, after that a node only propagates from the rows its assignment pruned
+    if (!enforceArcConsistency(initialDomains, initialBoard, Domain::firstN(n)))
+        return;
+
+    stateStack.push_back(AC3DVOSearchState<Domain, FixedN>(initialBoard, initialDomains));
+
+    while (!stateStack.empty())
+    {
+        // another solver claimed the k-th solution, stop here
+        if (limit && limit->stopped())
+            break;
+
+        // an idle worker needs work, hand it the oldest pending state (the one closest to the root)
+        if (splitter && stateStack.size() > 1 && splitter->wanted() && splitter->worthSplitting(n - countAssigned(stateStack.front().board)))
+        {
+            splitter->donate(toSolution(stateStack.front().board));
+            stateStack.pop_front();
+        }
+
+        AC3DVOSearchState<Domain, FixedN> current = stateStack.back();
+        stateStack.pop_back();
+
+        int depth = countAssigned(current.board);
+
+        // if maxDepth is set and we've reached it, add to work queue instead of continuing
+        // this is only used for the seed generator solver
+        if (maxDepth > 0 && depth == maxDepth)
+        {
+            std::lock_guard<std::mutex> lock(*queueMutex);
+            workQueue->push(toSolution(current.board));
+            continue;
+        }
+
+        // if solution is found
+        if (depth == n)
+        {
+            // k solutions are already in (maybe from another thread), this one doesn't count
+            if (limit && !limit->claim(current.board))
+                continue;
+
+            solutionCount++;
+            if (batch)
+                batch->add(current.board);
+            else if (!countOnly)
+                solutions.push_back(toSolution(current.board));
+
+            if (!foundFirst)
+            {
+                firstSolutionTime = std::chrono::high_resolution_clock::now();
+                foundFirst = true;
+            }
+            continue;
+        }
+
+        // select row with mrv left
+        int row = selectMRVRow(current.board, current.domains);
+
+        if (row == -1)
+            continue; // no valid row, but like, this shouldnt happen?
+
+        stats.node(depth);
+
+        Domain domain = current.domains[row];
+
+        for (int col = 0; col < n; col++)
+        {
+            if (!domain.test(col))
+                continue; // this value is not in domain
+
+            // create new state with updated domains
+            Domains newDomains = current.domains;
+
+            // mark this row as assigned
+            newDomains[row] = Domain();
+
+            // remove columns attacked by (row, col) using precomputed mask
+            Domain changedRows;
+            for (int otherRow = 0; otherRow < n; otherRow++)
+            {
+                if (otherRow != row)
+                {
+                    Domain pruned = newDomains[otherRow] & ~attackMask(row, otherRow, col);
+                    if (pruned != newDomains[otherRow])
+                    {
+                        newDomains[otherRow] = pruned;
+                        changedRows.set(otherRow);
+                    }
+                }
+            }
+
+            Board newBoard = current.board;
+            newBoard[row] = col;
+
+            // enforce arc consistency
+            if (enforceArcConsistency(newDomains, newBoard, changedRows))
+            {
+                stateStack.push_back(AC3DVOSearchState<Domain, FixedN>(newBoard, newDomains));
+            }
+            else
+                stats.prune();
+        }
+        stats.stack(stateStack.size());
+    }
+}
+
+template <typename Domain, int FixedN>
+const std::vector<Solution> &AC3DVOSolver<Domain, FixedN>::getSolutions() const
+{
+    return solutions;
+}
+
+template <typename Domain, int FixedN>
+std::vector<Solution> AC3DVOSolver<Domain, FixedN>::takeSolutions()
+{
+    std::vector<Solution> taken;
+    taken.swap(solutions);
+    return taken;
+}
+
+template <typename Domain, int FixedN>
+std::chrono::high_resolution_clock::time_point AC3DVOSolver<Domain, FixedN>::getFirstSolutionTime() const
+{
+    return firstSolutionTime;
+}
+
+template <typename Domain, int FixedN>
+const SearchStats &AC3DVOSolver<Domain, FixedN>::getStats() const
+{
+    return stats;
+}
+
+template <typename Domain, int FixedN>
+uint64_t AC3DVOSolver<Domain, FixedN>::getSolutionCount() const
+{
+    return solutionCount;
+}
+
+INSTANTIATE_FOR_BITSETS(AC3DVOSolver)
+INSTANTIATE_FOR_FIXED_SIZES(AC3DVOSolver)
\ No newline at end of file
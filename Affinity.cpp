@@ -0,0 +1,191 @@
+#include "Affinity.h"
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <fstream>
+#include <sstream>
+#endif
+
+// smt siblings get their rank from the order they show up in, cpus have to be sorted by index within a core
+static void rankSiblings(std::vector<LogicalCpu> &cpus)
+{
+    std::map<int, int> seen;
+    for (LogicalCpu &cpu : cpus)
+        cpu.siblingRank = seen[cpu.core]++;
+}
+
+#ifdef _WIN32
+
+// cores and numa nodes come from GetLogicalProcessorInformationEx, as affinity masks per processor group
+static std::vector<char> processorInformation(LOGICAL_PROCESSOR_RELATIONSHIP relation)
+{
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(relation, nullptr, &length);
+
+    std::vector<char> buffer(length);
+    if (length == 0 || !GetLogicalProcessorInformationEx(relation, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length))
+        buffer.clear();
+    return buffer;
+}
+
+template <typename Visit>
+static void forEachEntry(const std::vector<char> &buffer, Visit visit)
+{
+    size_t offset = 0;
+    while (offset < buffer.size())
+    {
+        auto entry = reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX *>(buffer.data() + offset);
+        visit(*entry);
+        offset += entry->Size;
+    }
+}
+
+CpuTopology CpuTopology::detect()
+{
+    CpuTopology topology;
+
+    forEachEntry(processorInformation(RelationProcessorCore), [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX &entry) {
+        const GROUP_AFFINITY &mask = entry.Processor.GroupMask[0];
+        for (int bit = 0; bit < 64; bit++)
+        {
+            if (mask.Mask & (KAFFINITY(1) << bit))
+                topology.cpus.push_back(LogicalCpu{mask.Group, bit, topology.cores, 0, 0});
+        }
+        topology.cores++;
+    });
+
+    forEachEntry(processorInformation(RelationNumaNode), [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX &entry) {
+        const GROUP_AFFINITY &mask = entry.NumaNode.GroupMask;
+        for (LogicalCpu &cpu : topology.cpus)
+        {
+            if (cpu.group == mask.Group && (mask.Mask & (KAFFINITY(1) << cpu.index)))
+                cpu.node = static_cast<int>(entry.NumaNode.NodeNumber);
+        }
+        topology.nodes++;
+    });
+
+    rankSiblings(topology.cpus);
+    topology.nodes = std::max(topology.nodes, 1);
+    return topology;
+}
+
+bool pinCurrentThread(const LogicalCpu &cpu)
+{
+    GROUP_AFFINITY affinity = {};
+    affinity.Group = static_cast<WORD>(cpu.group);
+    affinity.Mask = KAFFINITY(1) << cpu.index;
+    return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+}
+
+#else
+
+// cores and numa nodes come from sysfs, only cpus in the process's affinity mask (taskset, cgroups) are used
+static int readNumber(const std::string &path, int fallback)
+{
+    std::ifstream file(path);
+    int value;
+    return file >> value ? value : fallback;
+}
+
+// "0-3,8-11" -> 0 1 2 3 8 9 10 11
+static std::vector<int> parseCpuList(const std::string &list)
+{
+    std::vector<int> cpus;
+    std::stringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ','))
+    {
+        size_t dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+CpuTopology CpuTopology::detect()
+{
+    CpuTopology topology;
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        return topology;
+
+    std::map<int, int> nodeOf;
+    for (int node = 0;; node++)
+    {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string list;
+        if (!std::getline(file, list))
+            break;
+        for (int cpu : parseCpuList(list))
+            nodeOf[cpu] = node;
+        topology.nodes++;
+    }
+
+    // core_id is only unique within a package
+    std::map<std::pair<int, int>, int> coreOf;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (!CPU_ISSET(cpu, &allowed))
+            continue;
+
+        std::string dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        std::pair<int, int> key(readNumber(dir + "physical_package_id", 0), readNumber(dir + "core_id", cpu));
+        auto found = coreOf.emplace(key, static_cast<int>(coreOf.size())).first;
+
+        auto node = nodeOf.find(cpu);
+        topology.cpus.push_back(LogicalCpu{0, cpu, found->second, node == nodeOf.end() ? 0 : node->second, 0});
+    }
+
+    rankSiblings(topology.cpus);
+    topology.cores = static_cast<int>(coreOf.size());
+    topology.nodes = std::max(topology.nodes, 1);
+    return topology;
+}
+
+bool pinCurrentThread(const LogicalCpu &cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu.index, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+#endif
+
+std::string CpuTopology::describe() const
+{
+    return std::to_string(nodes) + " nodes " + std::to_string(cores) + " cores " + std::to_string(cpus.size()) + " cpus";
+}
+
+std::vector<LogicalCpu> workerPlacement(const CpuTopology &topology, const std::string &mode)
+{
+    std::vector<LogicalCpu> placement;
+    if (mode != "CORES" && mode != "PHYSICAL")
+        return placement;
+
+    for (const LogicalCpu &cpu : topology.cpus)
+    {
+        if (mode == "CORES" || cpu.siblingRank == 0)
+            placement.push_back(cpu);
+    }
+
+    // every core's first cpu before any sibling, and within that one node after the other
+    std::stable_sort(placement.begin(), placement.end(), [](const LogicalCpu &a, const LogicalCpu &b) {
+        if (a.siblingRank != b.siblingRank)
+            return a.siblingRank < b.siblingRank;
+        if (a.node != b.node)
+            return a.node < b.node;
+        return a.core < b.core;
+    });
+    return placement;
+}
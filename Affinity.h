@@ -0,0 +1,39 @@
+#ifndef AFFINITY_H
+#define AFFINITY_H
+
+#include <string>
+#include <vector>
+
+// one logical cpu (hardware thread) and where it sits
+struct LogicalCpu
+{
+    int group;       // windows processor group, always 0 elsewhere
+    int index;       // cpu number inside its group
+    int core;        // physical core, smt siblings share it
+    int node;        // numa node
+    int siblingRank; // 0 for the first logical cpu of its core, 1 for its smt sibling...
+};
+
+struct CpuTopology
+{
+    std::vector<LogicalCpu> cpus; // every cpu this process may run on
+    int cores = 0;
+    int nodes = 0;
+
+    static CpuTopology detect();
+
+    // e.g. "2 nodes 32 cores 64 cpus", no commas so it can go straight into the csv
+    std::string describe() const;
+};
+
+// cpus to pin workers 0, 1, 2... to, empty for NONE (the os places the threads)
+// CORES uses every logical cpu, but puts a worker on every physical core (node by node) before any smt sibling gets one
+// PHYSICAL only uses the first logical cpu of every core, so no two workers ever share a core
+// with more workers than cpus the list wraps around
+std::vector<LogicalCpu> workerPlacement(const CpuTopology &topology, const std::string &mode);
+
+// pins the calling thread to cpu, false if the os refused
+// a worker pins itself before it allocates anything, so its solver, batch and trie land on its own numa node
+bool pinCurrentThread(const LogicalCpu &cpu);
+
+#endif
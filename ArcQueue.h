@@ -0,0 +1,133 @@
+#ifndef ARCQUEUE_H
+#define ARCQUEUE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+// order the AC3 solvers revise queued arcs in
+enum class ArcOrder
+{
+    Fifo,          // in the order they were queued
+    SmallestDomain // arcs pointing at the rows with the fewest values left first, so wipeouts show up sooner
+};
+
+// queue of arcs (row1, row2) for the AC3 solvers, an arc that is already waiting is never queued twice
+// Fifo is a plain ring, SmallestDomain keeps one fifo bucket per target domain size chained through a next
+// index per arc, both are allocated up front with room for every arc so pushing / popping never allocates
+// a bucket is picked when the arc is pushed, if row2 shrinks afterwards the arc just stays where it is
+class ArcQueue
+{
+private:
+    int shift; // arc id = row1 << shift | row2, so ids decode without a division
+    bool bySize;
+    std::vector<uint8_t> queued; // queued[id] = arc is waiting in the queue
+    size_t count;
+
+    // Fifo
+    std::vector<int> ring;
+    size_t head;
+
+    // SmallestDomain
+    std::vector<int> next;       // next[id] = arc queued after it in the same bucket, -1 if it's the last
+    std::vector<int> bucketHead; // bucketHead[size] = first arc with that target domain size, -1 if none
+    std::vector<int> bucketTail;
+    int lowestBucket; // every bucket below this one is empty
+
+    // bits needed to hold any row index
+    static int bitsFor(int boardSize)
+    {
+        int bits = 0;
+        while ((1 << bits) < boardSize)
+            bits++;
+        return bits;
+    }
+
+public:
+    ArcQueue(int boardSize, ArcOrder order)
+        : shift(bitsFor(boardSize)), bySize(order == ArcOrder::SmallestDomain),
+          queued(static_cast<size_t>(boardSize) << shift, 0), count(0), head(0), lowestBucket(0)
+    {
+        if (bySize)
+        {
+            next.assign(queued.size(), -1);
+            bucketHead.assign(boardSize + 1, -1);
+            bucketTail.assign(boardSize + 1, -1);
+        }
+        else
+        {
+            ring.resize(queued.size());
+        }
+    }
+
+    // whether push() looks at targetSize, so callers can skip counting domains when it doesn't
+    bool prioritized() const { return bySize; }
+
+    bool empty() const { return count == 0; }
+
+    // targetSize = number of values left in row2
+    void push(int row1, int row2, int targetSize)
+    {
+        int arc = (row1 << shift) | row2;
+        if (queued[arc])
+            return;
+        queued[arc] = 1;
+
+        if (!bySize)
+        {
+            size_t tail = head + count;
+            if (tail >= ring.size())
+                tail -= ring.size();
+            ring[tail] = arc;
+        }
+        else
+        {
+            next[arc] = -1;
+            if (bucketTail[targetSize] == -1)
+                bucketHead[targetSize] = arc;
+            else
+                next[bucketTail[targetSize]] = arc;
+            bucketTail[targetSize] = arc;
+
+            if (targetSize < lowestBucket)
+                lowestBucket = targetSize;
+        }
+        count++;
+    }
+
+    // must not be empty
+    std::pair<int, int> pop()
+    {
+        int arc;
+        if (!bySize)
+        {
+            arc = ring[head];
+            if (++head == ring.size())
+                head = 0;
+        }
+        else
+        {
+            while (bucketHead[lowestBucket] == -1)
+                lowestBucket++;
+
+            arc = bucketHead[lowestBucket];
+            bucketHead[lowestBucket] = next[arc];
+            if (bucketHead[lowestBucket] == -1)
+                bucketTail[lowestBucket] = -1;
+        }
+
+        queued[arc] = 0;
+        count--;
+        return {arc >> shift, arc & ((1 << shift) - 1)};
+    }
+
+    // drop whatever is left, e.g. after a wipeout
+    void clear()
+    {
+        while (!empty())
+            pop();
+    }
+};
+
+#endif
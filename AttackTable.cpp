@@ -0,0 +1,58 @@
+#include "AttackTable.h"
+#include <map>
+#include <mutex>
+#include <new>
+
+static constexpr std::size_t CACHE_LINE = 64;
+
+template <typename Domain>
+AttackTable<Domain>::AttackTable(int boardSize) : n(boardSize)
+{
+    std::size_t count = static_cast<std::size_t>(n) * n;
+    masks = static_cast<Domain *>(::operator new(count * sizeof(Domain), std::align_val_t(CACHE_LINE)));
+
+    // distance 0 would be the same row, nothing ever asks for it
+    for (int col = 0; col < n; col++)
+        new (&masks[col]) Domain();
+
+    for (int distance = 1; distance < n; distance++)
+    {
+        for (int col = 0; col < n; col++)
+        {
+            // column
+            Domain mask = Domain::single(col);
+
+            // diagonals
+            if (col + distance < n)
+                mask.set(col + distance);
+            if (col - distance >= 0)
+                mask.set(col - distance);
+
+            new (&masks[distance * n + col]) Domain(mask);
+        }
+    }
+}
+
+template <typename Domain>
+AttackTable<Domain>::~AttackTable()
+{
+    ::operator delete(masks, std::align_val_t(CACHE_LINE));
+}
+
+template <typename Domain>
+std::shared_ptr<const AttackTable<Domain>> AttackTable<Domain>::get(int boardSize)
+{
+    // tables never change, so they just live until the process exits
+    static std::mutex cacheMutex;
+    static std::map<int, std::shared_ptr<const AttackTable>> cache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    std::shared_ptr<const AttackTable> &table = cache[boardSize];
+    if (!table)
+        table.reset(new AttackTable(boardSize));
+
+    return table;
+}
+
+INSTANTIATE_FOR_BITSETS(AttackTable)
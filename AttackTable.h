@@ -0,0 +1,74 @@
+#ifndef ATTACKTABLE_H
+#define ATTACKTABLE_H
+
+#include "Bitset.h"
+#include <memory>
+#include <array>
+
+// columns attacked in one row by a queen sitting in another row
+// the mask only depends on how far apart the two rows are, so it's stored as one flat
+// [distance][col] block (n * n masks) instead of a nested [r1][r2][col] vector
+template <typename Domain>
+class AttackTable
+{
+private:
+    int n;
+    Domain *masks; // n * n entries, starts on a cache line
+
+    explicit AttackTable(int boardSize);
+
+public:
+    ~AttackTable();
+    AttackTable(const AttackTable &) = delete;
+    AttackTable &operator=(const AttackTable &) = delete;
+
+    // built the first time a board size is asked for, then shared read only by every solver and thread
+    static std::shared_ptr<const AttackTable> get(int boardSize);
+
+    // columns in row2 attacked by a queen at (row1, col)
+    inline const Domain &mask(int row1, int row2, int col) const
+    {
+        int distance = row1 > row2 ? row1 - row2 : row2 - row1;
+        return masks[distance * n + col];
+    }
+};
+
+// same [distance][col] layout for a board size known at compile time, generated by the compiler
+// so lookups are a load from a constant address instead of going through a pointer
+template <typename Domain, int N>
+struct FixedAttackTable
+{
+    static constexpr std::array<Domain, N * N> build()
+    {
+        std::array<Domain, N * N> table{};
+
+        for (int distance = 1; distance < N; distance++)
+        {
+            for (int col = 0; col < N; col++)
+            {
+                // column
+                Domain mask = Domain::single(col);
+
+                // diagonals
+                if (col + distance < N)
+                    mask.set(col + distance);
+                if (col - distance >= 0)
+                    mask.set(col - distance);
+
+                table[distance * N + col] = mask;
+            }
+        }
+        return table;
+    }
+
+    alignas(64) static constexpr std::array<Domain, N * N> masks = build();
+
+    // columns in row2 attacked by a queen at (row1, col)
+    static inline const Domain &mask(int row1, int row2, int col)
+    {
+        int distance = row1 > row2 ? row1 - row2 : row2 - row1;
+        return masks[distance * N + col];
+    }
+};
+
+#endif
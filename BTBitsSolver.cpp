@@ -0,0 +1,181 @@
+#include "BTBitsSolver.h"
+
+template <typename Domain>
+BTBitsSolver<Domain>::BTBitsSolver(int boardSize, const Solution &initial, int maxDepth, std::queue<Solution> *wq, std::mutex *qm, bool countOnly, SolutionBatch *batch, SearchLimit *limit, WorkSplitter *splitter)
+    : n(boardSize), initialState(initial), foundFirst(false), maxDepth(maxDepth), workQueue(wq), queueMutex(qm), countOnly(countOnly), solutionCount(0), batch(batch), limit(limit), splitter(splitter)
+{
+    fullMask = Domain::firstN(n);
+    frames.resize(n + 1);
+}
+
+template <typename Domain>
+void BTBitsSolver<Domain>::reset(const Solution &initial)
+{
+    initialState = initial;
+    solutions.clear();
+    solutionCount = 0;
+    foundFirst = false;
+    stats.clear();
+}
+
+// free columns of row, a row that is already set in the initial state only gets its own column back
+template <typename Domain>
+inline Domain BTBitsSolver<Domain>::candidates(int row, const BitsFrame<Domain> &frame) const
+{
+    Domain available = fullMask & ~(frame.cols | frame.diagLeft | frame.diagRight);
+
+    if (initialState[row] != -1)
+        available &= Domain::single(initialState[row]);
+
+    return available;
+}
+
+// a frame just got its candidates, every column the queens above ruled out counts as a pruned child
+template <typename Domain>
+inline void BTBitsSolver<Domain>::countNode(int row, const BitsFrame<Domain> &frame)
+{
+    if constexpr (SEARCH_STATS)
+    {
+        int allowed = initialState[row] != -1 ? 1 : n;
+        stats.node(row);
+        stats.prune(allowed - frame.remaining.count());
+        stats.stack(row + 1);
+    }
+}
+
+template <typename Domain>
+void BTBitsSolver<Domain>::solve()
+{
+    if (n == 0)
+        return;
+
+    // rows are always walked from 0, so partial boards (even non prefix ones from the dvo seeders) are
+    // folded into the masks as we go instead of being trusted blindly
+    Solution board = initialState;
+
+    int row = 0;
+    frames[0] = BitsFrame<Domain>{};
+    frames[0].remaining = candidates(0, frames[0]);
+    countNode(0, frames[0]);
+
+    while (row >= 0)
+    {
+        // another solver claimed the k-th solution, stop here
+        if (limit && limit->stopped())
+            break;
+
+        // an idle worker needs work, hand it the next column of the shallowest row above this one that has one left
+        if (splitter && row > 0 && splitter->wanted())
+        {
+            for (int above = 0; above < row && splitter->worthSplitting(n - above - 1); above++)
+            {
+                BitsFrame<Domain> &pending = frames[above];
+                if (pending.remaining.none())
+                    continue;
+
+                // the seed is the path down to that row plus the donated column
+                Solution seed = initialState;
+                for (int r = 0; r < above; r++)
+                    seed[r] = board[r];
+                seed[above] = pending.remaining.lowest();
+                pending.remaining.clearLowest();
+
+                splitter->donate(seed);
+                break;
+            }
+        }
+
+        BitsFrame<Domain> &frame = frames[row];
+
+        // every column of this row has been tried, go back up
+        if (frame.remaining.none())
+        {
+            board[row] = initialState[row];
+            row--;
+            continue;
+        }
+
+        // take the lowest free column
+        int col = frame.remaining.lowest();
+        frame.remaining.clearLowest();
+        board[row] = col;
+
+        Domain bit = Domain::single(col);
+
+        int nextRow = row + 1;
+
+        // if maxDepth is set and we've reached it, add to work queue instead of continuing
+        // this is only used for the seed generator solver
+        if (maxDepth > 0 && nextRow == maxDepth)
+        {
+            std::lock_guard<std::mutex> lock(*queueMutex);
+            workQueue->push(board);
+            continue;
+        }
+
+        // if solution is found
+        if (nextRow == n)
+        {
+            // k solutions are already in (maybe from another thread), this one doesn't count
+            if (limit && !limit->claim(board))
+                continue;
+
+            solutionCount++;
+            if (batch)
+                batch->add(board);
+            else if (!countOnly)
+                solutions.push_back(board);
+
+            if (!foundFirst)
+            {
+                firstSolutionTime = std::chrono::high_resolution_clock::now();
+                foundFirst = true;
+            }
+            continue;
+        }
+
+        // shift the diagonals down one row, whatever falls off the board is dropped
+        BitsFrame<Domain> &child = frames[nextRow];
+        child.cols = frame.cols | bit;
+        child.diagLeft = (frame.diagLeft | bit).shiftUp() & fullMask;
+        child.diagRight = (frame.diagRight | bit).shiftDown();
+        child.remaining = candidates(nextRow, child);
+        countNode(nextRow, child);
+
+        row = nextRow;
+    }
+}
+
+template <typename Domain>
+const std::vector<Solution> &BTBitsSolver<Domain>::getSolutions() const
+{
+    return solutions;
+}
+
+template <typename Domain>
+std::vector<Solution> BTBitsSolver<Domain>::takeSolutions()
+{
+    std::vector<Solution> taken;
+    taken.swap(solutions);
+    return taken;
+}
+
+template <typename Domain>
+std::chrono::high_resolution_clock::time_point BTBitsSolver<Domain>::getFirstSolutionTime() const
+{
+    return firstSolutionTime;
+}
+
+template <typename Domain>
+uint64_t BTBitsSolver<Domain>::getSolutionCount() const
+{
+    return solutionCount;
+}
+
+template <typename Domain>
+const SearchStats &BTBitsSolver<Domain>::getStats() const
+{
+    return stats;
+}
+
+INSTANTIATE_FOR_BITSETS(BTBitsSolver)
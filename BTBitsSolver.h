@@ -0,0 +1,71 @@
+#ifndef BTBITSSOLVER_H
+#define BTBITSSOLVER_H
+
+#include "Solver.h"
+#include "SolutionSink.h"
+#include "SearchLimit.h"
+#include "WorkStealingPool.h"
+#include "Bitset.h"
+#include <queue>
+#include <mutex>
+#include <vector>
+
+// one level of the bitboard search
+// every mask is already shifted to line up with the columns of this frame's row
+template <typename Domain>
+struct BitsFrame
+{
+    Domain cols;      // columns taken by queens above
+    Domain diagLeft;  // columns hit by diagonals going down-left
+    Domain diagRight; // columns hit by diagonals going down-right
+    Domain remaining; // columns of this row we still have to try
+};
+
+template <typename Domain>
+class BTBitsSolver : public Solver
+{
+private:
+    int n;
+    Solution initialState;
+    std::vector<Solution> solutions;
+    std::chrono::high_resolution_clock::time_point firstSolutionTime;
+    bool foundFirst;
+    int maxDepth;
+    std::queue<Solution> *workQueue;
+    std::mutex *queueMutex;
+
+    // count only mode: solutions are just counted, the boards are never stored
+    bool countOnly;
+    uint64_t solutionCount;
+
+    // streaming mode: solutions go straight to this thread's batch instead of being stored
+    SolutionBatch *batch;
+
+    // first-k mode: shared with every other solver of the run, the search stops once it runs out
+    SearchLimit *limit;
+
+    // dynamic splitting: set for parallel workers, lets the search hand pending subtrees to idle workers
+    WorkSplitter *splitter;
+
+    Domain fullMask; // lowest n bits set
+
+    // frames[row] = occupancy seen by row, allocated once so a node costs no heap traffic
+    std::vector<BitsFrame<Domain>> frames;
+
+    SearchStats stats;
+
+    inline Domain candidates(int row, const BitsFrame<Domain> &frame) const;
+    inline void countNode(int row, const BitsFrame<Domain> &frame);
+
+public:
+    BTBitsSolver(int boardSize, const Solution &initial, int maxDepth = 0, std::queue<Solution> *wq = nullptr, std::mutex *qm = nullptr, bool countOnly = false, SolutionBatch *batch = nullptr, SearchLimit *limit = nullptr, WorkSplitter *splitter = nullptr);
+    void solve() override;
+    void reset(const Solution &initial) override;
+    const std::vector<Solution> &getSolutions() const override;
+    std::vector<Solution> takeSolutions() override;
+    std::chrono::high_resolution_clock::time_point getFirstSolutionTime() const override;
+    uint64_t getSolutionCount() const override;
+    const SearchStats &getStats() const override;
+};
+
+#endif
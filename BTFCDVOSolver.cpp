@@ -1,223 +1,243 @@
-#include "BTFCDVOSolver.h"
-#include <cmath>
-
-BTFCDVOSolver::BTFCDVOSolver(int boardSize, const Solution &initial, int maxDepth, std::queue<Solution> *wq, std::mutex *qm)
-    : n(boardSize), initialState(initial), foundFirst(false), maxDepth(maxDepth), workQueue(wq), queueMutex(qm)
-{
-    precomputeAttackMasks();
-}
-
-void BTFCDVOSolver::precomputeAttackMasks()
-{
-    // we're only computing attackMask once, then resuing it per check
-    // attackMask[r1][r2][col] = bitmask of columns in r2 attacked by queen at (r1, col)
-    attackMask.resize(n, std::vector<std::vector<uint64_t>>(n, std::vector<uint64_t>(n, 0)));
-
-    for (int r1 = 0; r1 < n; r1++)
-    {
-        for (int r2 = 0; r2 < n; r2++)
-        {
-            if (r1 == r2)
-                continue;
-
-            for (int col = 0; col < n; col++)
-            {
-                uint64_t mask = 0;
-
-                // column
-                mask |= (1ULL << col);
-
-                // diagonals
-                int diagDist = abs(r2 - r1);
-                if (col + diagDist < n)
-                    mask |= (1ULL << (col + diagDist));
-                if (col - diagDist >= 0)
-                    mask |= (1ULL << (col - diagDist));
-
-                attackMask[r1][r2][col] = mask;
-            }
-        }
-    }
-}
-
-// we could have just used this https://www.geeksforgeeks.org/cpp/cpp-__builtin_popcount-function/
-inline int BTFCDVOSolver::popcount(uint64_t x) const
-{
-    int count = 0;
-    while (x)
-    {
-        count++;
-        x &= x - 1;
-    }
-    return count;
-}
-
-std::vector<uint64_t> BTFCDVOSolver::initializeDomains(const Solution &board) const
-{
-    // start with all columns available
-    std::vector<uint64_t> domains(n, (1ULL << n) - 1);
-
-    // then remove attacked columns based on already-assigned queens
-    for (int row = 0; row < n; row++)
-    {
-        if (board[row] != -1)
-        {
-            int col = board[row];
-            domains[row] = 0; // set row as assigned
-
-            // remove columns attacked by this queen using precomputed mask
-            for (int otherRow = 0; otherRow < n; otherRow++)
-            {
-                if (otherRow != row)
-                {
-                    // available &= ~attackMask[prevRow][row][prevCol];
-                    domains[otherRow] &= ~attackMask[row][otherRow][col];
-                }
-            }
-        }
-    }
-
-    return domains;
-}
-
-int BTFCDVOSolver::selectMRVRow(const Solution &board, const std::vector<uint64_t> &domains) const
-{
-    int bestRow = -1;
-    int minDomainSize = n + 1;
-
-    for (int row = 0; row < n; row++)
-    {
-        // already assigned
-        if (board[row] != -1)
-            continue;
-
-        int domainSize = popcount(domains[row]);
-
-        if (domainSize < minDomainSize)
-        {
-            minDomainSize = domainSize;
-            bestRow = row;
-        }
-    }
-
-    return bestRow;
-}
-
-int BTFCDVOSolver::countAssigned(const Solution &board) const
-{
-    int count = 0;
-    for (int i = 0; i < n; i++)
-    {
-        if (board[i] != -1)
-            count++;
-    }
-    return count;
-}
-
-void BTFCDVOSolver::solve()
-{
-    std::stack<DVOSearchState> stateStack;
-
-    std::vector<uint64_t> initialDomains = initializeDomains(initialState);
-
-    stateStack.push(DVOSearchState(initialState, initialDomains));
-
-    while (!stateStack.empty())
-    {
-        DVOSearchState current = stateStack.top();
-        stateStack.pop();
-
-        // if maxDepth is set and we've reached it, add to work queue instead of continuing
-        // this is only used for the seed generator solver
-        if (maxDepth > 0 && countAssigned(current.board) == maxDepth)
-        {
-            std::lock_guard<std::mutex> lock(*queueMutex);
-            workQueue->push(current.board);
-            continue;
-        }
-
-        // if solution is found
-        if (countAssigned(current.board) == n)
-        {
-            solutions.push_back(current.board);
-
-            if (!foundFirst)
-            {
-                firstSolutionTime = std::chrono::high_resolution_clock::now();
-                foundFirst = true;
-            }
-            continue;
-        }
-
-        // select row with mrv left
-        int row = selectMRVRow(current.board, current.domains);
-
-        if (row == -1)
-            continue; // no valid row, but like, this shouldnt happen?
-
-        uint64_t domain = current.domains[row];
-
-        for (int col = 0; col < n; col++)
-        {
-            if (!(domain & (1ULL << col)))
-                continue; // this value is not in domain
-
-            // forward check
-            // would this assignment wipe out any future domain? if yes, die
-            bool causesWipeout = false;
-
-            for (int futureRow = 0; futureRow < n; futureRow++)
-            {
-                if (current.board[futureRow] != -1)
-                    continue; // already assigned
-                if (futureRow == row)
-                    continue; // its the current row
-
-                uint64_t futureDomain = current.domains[futureRow];
-
-                // remove columns attacked by (row, col) using precomputed mask
-                futureDomain &= ~attackMask[row][futureRow][col];
-
-                if (futureDomain == 0)
-                {
-                    causesWipeout = true;
-                    break;
-                }
-            }
-
-            if (causesWipeout)
-                continue;
-
-            std::vector<uint64_t> newDomains = current.domains;
-
-            // update domains by remove attacked columns
-            for (int futureRow = 0; futureRow < n; futureRow++)
-            {
-                if (current.board[futureRow] != -1)
-                    continue; // already assigned
-                if (futureRow == row)
-                    continue; // its the current row
-
-                newDomains[futureRow] &= ~attackMask[row][futureRow][col];
-            }
-
-            // mark this row as assigned
-            newDomains[row] = 0;
-
-            Solution newBoard = current.board;
-            newBoard[row] = col;
-            stateStack.push(DVOSearchState(newBoard, newDomains));
-            // stateStack.push(FCSearchState(newBoard, current.row + 1, newDomains));
-        }
-    }
-}
-
-const std::vector<Solution> &BTFCDVOSolver::getSolutions() const
-{
-    return solutions;
-}
-
-std::chrono::high_resolution_clock::time_point BTFCDVOSolver::getFirstSolutionTime() const
-{
-    return firstSolutionTime;
-}
\ No newline at end of file
+#include "BTFCDVOSolver.h"
+#include <cmath>
+
+template <typename Domain, int FixedN>
+BTFCDVOSolver<Domain, FixedN>::BTFCDVOSolver(int boardSize, const Solution &initial, int maxDepth, std::queue<Solution> *wq, std::mutex *qm, bool countOnly, SolutionBatch *batch, SearchLimit *limit, WorkSplitter *splitter)
+    : BoardSize<FixedN>(boardSize), initialState(initial), foundFirst(false), maxDepth(maxDepth), workQueue(wq), queueMutex(qm), countOnly(countOnly), solutionCount(0), batch(batch), limit(limit), splitter(splitter),
+      attacks(FixedN > 0 ? nullptr : AttackTable<Domain>::get(boardSize)) {}
+
+template <typename Domain, int FixedN>
+void BTFCDVOSolver<Domain, FixedN>::reset(const Solution &initial)
+{
+    initialState = initial;
+    solutions.clear();
+    solutionCount = 0;
+    foundFirst = false;
+    stats.clear();
+}
+
+template <typename Domain, int FixedN>
+typename BTFCDVOSolver<Domain, FixedN>::Domains BTFCDVOSolver<Domain, FixedN>::initializeDomains(const Solution &board) const
+{
+    // start with all columns available
+    Domains domains = makeRowArray<Domain, FixedN>(n, Domain::firstN(n));
+
+    // then remove attacked columns based on already-assigned queens
+    for (int row = 0; row < n; row++)
+    {
+        if (board[row] != -1)
+        {
+            int col = board[row];
+            domains[row] = Domain(); // set row as assigned
+
+            // remove columns attacked by this queen using precomputed mask
+            for (int otherRow = 0; otherRow < n; otherRow++)
+            {
+                if (otherRow != row)
+                {
+                    // available &= ~attackMask(prevRow, row, prevCol);
+                    domains[otherRow] &= ~attackMask(row, otherRow, col);
+                }
+            }
+        }
+    }
+
+    return domains;
+}
+
+template <typename Domain, int FixedN>
+int BTFCDVOSolver<Domain, FixedN>::selectMRVRow(const Board &board, const Domains &domains) const
+{
+    int bestRow = -1;
+    int minDomainSize = n + 1;
+
+    for (int row = 0; row < n; row++)
+    {
+        // already assigned
+        if (board[row] != -1)
+            continue;
+
+        int domainSize = domains[row].count();
+
+        if (domainSize < minDomainSize)
+        {
+            minDomainSize = domainSize;
+            bestRow = row;
+        }
+    }
+
+    return bestRow;
+}
+
+template <typename Domain, int FixedN>
+int BTFCDVOSolver<Domain, FixedN>::countAssigned(const Board &board) const
+{
+    int count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (board[i] != -1)
+            count++;
+    }
+    return count;
+}
+
+template <typename Domain, int FixedN>
+void BTFCDVOSolver<Domain, FixedN>::solve()
+{
+    std::deque<DVOSearchState<Domain, FixedN>> stateStack;
+
+    Domains initialDomains = initializeDomains(initialState);
+
+    stateStack.push_back(DVOSearchState<Domain, FixedN>(makeBoard<FixedN>(initialState), initialDomains));
+
+    while (!stateStack.empty())
+    {
+        // another solver claimed the k-th solution, stop here
+        if (limit && limit->stopped())
+            break;
+
+        // an idle worker needs work, hand it the oldest pending state (the one closest to the root)
+        if (splitter && stateStack.size() > 1 && splitter->wanted() && splitter->worthSplitting(n - countAssigned(stateStack.front().board)))
+        {
+            splitter->donate(toSolution(stateStack.front().board));
+            stateStack.pop_front();
+        }
+
+        DVOSearchState<Domain, FixedN> current = stateStack.back();
+        stateStack.pop_back();
+
+        int depth = countAssigned(current.board);
+
+        // if maxDepth is set and we've reached it, add to work queue instead of continuing
+        // this is only used for the seed generator solver
+        if (maxDepth > 0 && depth == maxDepth)
+        {
+            std::lock_guard<std::mutex> lock(*queueMutex);
+            workQueue->push(toSolution(current.board));
+            continue;
+        }
+
+        // if solution is found
+        if (depth == n)
+        {
+            // k solutions are already in (maybe from another thread), this one doesn't count
+            if (limit && !limit->claim(current.board))
+                continue;
+
+            solutionCount++;
+            if (batch)
+                batch->add(current.board);
+            else if (!countOnly)
+                solutions.push_back(toSolution(current.board));
+
+            if (!foundFirst)
+            {
+                firstSolutionTime = std::chrono::high_resolution_clock::now();
+                foundFirst = true;
+            }
+            continue;
+        }
+
+        // select row with mrv left
+        int row = selectMRVRow(current.board, current.domains);
+
+        if (row == -1)
+            continue; // no valid row, but like, this shouldnt happen?
+
+        stats.node(depth);
+
+        Domain domain = current.domains[row];
+
+        for (int col = 0; col < n; col++)
+        {
+            if (!domain.test(col))
+                continue; // this value is not in domain
+
+            // forward check
+            // would this assignment wipe out any future domain? if yes, die
+            bool causesWipeout = false;
+
+            for (int futureRow = 0; futureRow < n; futureRow++)
+            {
+                if (current.board[futureRow] != -1)
+                    continue; // already assigned
+                if (futureRow == row)
+                    continue; // its the current row
+
+                Domain futureDomain = current.domains[futureRow];
+
+                // remove columns attacked by (row, col) using precomputed mask
+                futureDomain &= ~attackMask(row, futureRow, col);
+
+                if (futureDomain.none())
+                {
+                    causesWipeout = true;
+                    break;
+                }
+            }
+
+            if (causesWipeout)
+            {
+                stats.prune();
+                continue;
+            }
+
+            Domains newDomains = current.domains;
+
+            // update domains by remove attacked columns
+            for (int futureRow = 0; futureRow < n; futureRow++)
+            {
+                if (current.board[futureRow] != -1)
+                    continue; // already assigned
+                if (futureRow == row)
+                    continue; // its the current row
+
+                newDomains[futureRow] &= ~attackMask(row, futureRow, col);
+            }
+
+            // mark this row as assigned
+            newDomains[row] = Domain();
+
+            Board newBoard = current.board;
+            newBoard[row] = col;
+            stateStack.push_back(DVOSearchState<Domain, FixedN>(newBoard, newDomains));
+            // stateStack.push(FCSearchState(newBoard, current.row + 1, newDomains));
+        }
+        stats.stack(stateStack.size());
+    }
+}
+
+template <typename Domain, int FixedN>
+const std::vector<Solution> &BTFCDVOSolver<Domain, FixedN>::getSolutions() const
+{
+    return solutions;
+}
+
+template <typename Domain, int FixedN>
+std::vector<Solution> BTFCDVOSolver<Domain, FixedN>::takeSolutions()
+{
+    std::vector<Solution> taken;
+    taken.swap(solutions);
+    return taken;
+}
+
+template <typename Domain, int FixedN>
+std::chrono::high_resolution_clock::time_point BTFCDVOSolver<Domain, FixedN>::getFirstSolutionTime() const
+{
+    return firstSolutionTime;
+}
+
+template <typename Domain, int FixedN>
+uint64_t BTFCDVOSolver<Domain, FixedN>::getSolutionCount() const
+{
+    return solutionCount;
+}
+
+template <typename Domain, int FixedN>
+const SearchStats &BTFCDVOSolver<Domain, FixedN>::getStats() const
+{
+    return stats;
+}
+
+INSTANTIATE_FOR_BITSETS(BTFCDVOSolver)
+INSTANTIATE_FOR_FIXED_SIZES(BTFCDVOSolver)
\ No newline at end of file
@@ -1,47 +1,84 @@
-#ifndef BTFCDVOSOLVER_H
-#define BTFCDVOSOLVER_H
-
-#include "Solver.h"
-#include <stack>
-#include <queue>
-#include <mutex>
-#include <vector>
-#include <cstdint>
-
-struct DVOSearchState
-{
-    Solution board;
-    std::vector<uint64_t> domains; // domains[i] = bitmask of available columns for row i
-
-    DVOSearchState(const Solution &b, const std::vector<uint64_t> &d) : board(b), domains(d) {}
-};
-
-class BTFCDVOSolver : public Solver
-{
-private:
-    int n;
-    Solution initialState;
-    std::vector<Solution> solutions;
-    std::chrono::high_resolution_clock::time_point firstSolutionTime;
-    bool foundFirst;
-    int maxDepth;
-    std::queue<Solution> *workQueue;
-    std::mutex *queueMutex;
-
-    // attackMask[r1][r2][col] = columns attacked in r2 if r1 has queen at col
-    std::vector<std::vector<std::vector<uint64_t>>> attackMask;
-
-    void precomputeAttackMasks();
-    inline int popcount(uint64_t x) const;
-    std::vector<uint64_t> initializeDomains(const Solution &board) const;
-    int selectMRVRow(const Solution &board, const std::vector<uint64_t> &domains) const;
-    int countAssigned(const Solution &board) const;
-
-public:
-    BTFCDVOSolver(int boardSize, const Solution &initial, int maxDepth = 0, std::queue<Solution> *wq = nullptr, std::mutex *qm = nullptr);
-    void solve() override;
-    const std::vector<Solution> &getSolutions() const override;
-    std::chrono::high_resolution_clock::time_point getFirstSolutionTime() const override;
-};
-
+#ifndef BTFCDVOSOLVER_H
+#define BTFCDVOSOLVER_H
+
+#include "Solver.h"
+#include "SolutionSink.h"
+#include "SearchLimit.h"
+#include "WorkStealingPool.h"
+#include "AttackTable.h"
+#include "Bitset.h"
+#include "FixedBoard.h"
+#include <deque>
+#include <queue>
+#include <mutex>
+#include <vector>
+#include <memory>
+
+template <typename Domain, int FixedN>
+struct DVOSearchState
+{
+    RowArray<int, FixedN> board;
+    RowArray<Domain, FixedN> domains; // domains[i] = bitmask of available columns for row i
+
+    DVOSearchState(const RowArray<int, FixedN> &b, const RowArray<Domain, FixedN> &d) : board(b), domains(d) {}
+};
+
+template <typename Domain, int FixedN = 0>
+class BTFCDVOSolver : public Solver, private BoardSize<FixedN>
+{
+private:
+    using BoardSize<FixedN>::n;
+    using Board = RowArray<int, FixedN>;
+    using Domains = RowArray<Domain, FixedN>;
+
+    Solution initialState;
+    std::vector<Solution> solutions;
+    std::chrono::high_resolution_clock::time_point firstSolutionTime;
+    bool foundFirst;
+    int maxDepth;
+    std::queue<Solution> *workQueue;
+    std::mutex *queueMutex;
+
+    // count only mode: solutions are just counted, the boards are never stored
+    bool countOnly;
+    uint64_t solutionCount;
+
+    // streaming mode: solutions go straight to this thread's batch instead of being stored
+    SolutionBatch *batch;
+
+    // first-k mode: shared with every other solver of the run, the search stops once it runs out
+    SearchLimit *limit;
+
+    // dynamic splitting: set for parallel workers, lets the search hand pending subtrees to idle workers
+    WorkSplitter *splitter;
+
+    SearchStats stats;
+
+    // attacks->mask(r1, r2, col) = columns attacked in r2 if r1 has queen at col, shared by every solver of this size
+    // left empty for fixed sizes, those read the compile time FixedAttackTable instead
+    std::shared_ptr<const AttackTable<Domain>> attacks;
+
+    inline const Domain &attackMask(int row1, int row2, int col) const
+    {
+        if constexpr (FixedN > 0)
+            return FixedAttackTable<Domain, FixedN>::mask(row1, row2, col);
+        else
+            return attacks->mask(row1, row2, col);
+    }
+
+    Domains initializeDomains(const Solution &board) const;
+    int selectMRVRow(const Board &board, const Domains &domains) const;
+    int countAssigned(const Board &board) const;
+
+public:
+    BTFCDVOSolver(int boardSize, const Solution &initial, int maxDepth = 0, std::queue<Solution> *wq = nullptr, std::mutex *qm = nullptr, bool countOnly = false, SolutionBatch *batch = nullptr, SearchLimit *limit = nullptr, WorkSplitter *splitter = nullptr);
+    void solve() override;
+    void reset(const Solution &initial) override;
+    const std::vector<Solution> &getSolutions() const override;
+    std::vector<Solution> takeSolutions() override;
+    std::chrono::high_resolution_clock::time_point getFirstSolutionTime() const override;
+    uint64_t getSolutionCount() const override;
+    const SearchStats &getStats() const override;
+};
+
 #endif
\ No newline at end of file
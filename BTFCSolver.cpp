@@ -1,168 +1,196 @@
-#include "BTFCSolver.h"
-#include <cmath>
-
-BTFCSolver::BTFCSolver(int boardSize, const Solution &initial, int maxDepth, std::queue<Solution> *wq, std::mutex *qm)
-    : n(boardSize), initialState(initial), foundFirst(false), maxDepth(maxDepth), workQueue(wq), queueMutex(qm)
-{
-    precomputeAttackMasks();
-}
-
-void BTFCSolver::precomputeAttackMasks()
-{
-    // we're only computing attackMask once, then resuing it per check
-    // attackMask[r1][r2][col] = bitmask of columns in r2 attacked by queen at (r1, col)
-    attackMask.resize(n, std::vector<std::vector<uint64_t>>(n, std::vector<uint64_t>(n, 0)));
-
-    for (int r1 = 0; r1 < n; r1++)
-    {
-        for (int r2 = 0; r2 < n; r2++)
-        {
-            if (r1 == r2)
-                continue;
-
-            for (int col = 0; col < n; col++)
-            {
-                uint64_t mask = 0;
-
-                // column
-                mask |= (1ULL << col);
-
-                // diagonals
-                int diagDist = abs(r2 - r1);
-                if (col + diagDist < n)
-                    mask |= (1ULL << (col + diagDist));
-                if (col - diagDist >= 0)
-                    mask |= (1ULL << (col - diagDist));
-
-                attackMask[r1][r2][col] = mask;
-            }
-        }
-    }
-}
-
-std::vector<uint64_t> BTFCSolver::initializeDomains(const Solution &board, int startRow) const
-{
-    std::vector<uint64_t> domains(n);
-
-    // initialize all unassigned rows with full domain
-    for (int row = startRow; row < n; row++)
-    {
-        uint64_t available = (1ULL << n) - 1;
-
-        // rmove columns that conflict with already assigned vars
-        for (int prevRow = 0; prevRow < row; prevRow++)
-        {
-            if (board[prevRow] != -1)
-            {
-                int prevCol = board[prevRow];
-                // remove columns attacked by this queen using precomputed mask
-                available &= ~attackMask[prevRow][row][prevCol];
-            }
-        }
-
-        domains[row] = available;
-    }
-
-    return domains;
-}
-
-void BTFCSolver::solve()
-{
-    std::stack<FCSearchState> stateStack;
-
-    // find first unassigned row in initial state
-    // can't start at 0, because parallel solvers have diff start states
-    int startRow = 0;
-    for (int i = 0; i < n; i++)
-    {
-        if (initialState[i] == -1)
-        {
-            startRow = i;
-            break;
-        }
-    }
-
-    // initialize domains for all unassigned rows
-    std::vector<uint64_t> initialDomains = initializeDomains(initialState, startRow);
-
-    stateStack.push(FCSearchState(initialState, startRow, initialDomains));
-
-    while (!stateStack.empty())
-    {
-        FCSearchState current = stateStack.top();
-        stateStack.pop();
-
-        // if maxDepth is set and we've reached it, add to work queue instead of continuing
-        // this is only used for the seed generator solver
-        if (maxDepth > 0 && current.row == maxDepth)
-        {
-            std::lock_guard<std::mutex> lock(*queueMutex);
-            workQueue->push(current.board);
-            continue;
-        }
-
-        // if solution is found
-        if (current.row == n)
-        {
-            solutions.push_back(current.board);
-
-            if (!foundFirst)
-            {
-                firstSolutionTime = std::chrono::high_resolution_clock::now();
-                foundFirst = true;
-            }
-            continue;
-        }
-
-        uint64_t domain = current.domains[current.row];
-
-        for (int col = 0; col < n; col++)
-        {
-            if (!(domain & (1ULL << col)))
-                continue; // this value is not in domain
-
-            // forward check
-            // would this assignment wipe out any future domain? if yes, die
-            bool causesWipeout = false;
-
-            for (int futureRow = current.row + 1; futureRow < n; futureRow++)
-            {
-                uint64_t futureDomain = current.domains[futureRow];
-
-                // remove columns attacked by (row, col) using precomputed mask
-                futureDomain &= ~attackMask[current.row][futureRow][col];
-
-                if (futureDomain == 0)
-                {
-                    causesWipeout = true;
-                    break;
-                }
-            }
-
-            if (causesWipeout)
-                continue;
-
-            std::vector<uint64_t> newDomains = current.domains;
-
-            // update domains by remove attacked columns
-            for (int futureRow = current.row + 1; futureRow < n; futureRow++)
-            {
-                newDomains[futureRow] &= ~attackMask[current.row][futureRow][col];
-            }
-
-            Solution newBoard = current.board;
-            newBoard[current.row] = col;
-            stateStack.push(FCSearchState(newBoard, current.row + 1, newDomains));
-        }
-    }
-}
-
-const std::vector<Solution> &BTFCSolver::getSolutions() const
-{
-    return solutions;
-}
-
-std::chrono::high_resolution_clock::time_point BTFCSolver::getFirstSolutionTime() const
-{
-    return firstSolutionTime;
-}
\ No newline at end of file
+#include "BTFCSolver.h"
+#include <cmath>
+
+template <typename Domain, int FixedN>
+BTFCSolver<Domain, FixedN>::BTFCSolver(int boardSize, const Solution &initial, int maxDepth, std::queue<Solution> *wq, std::mutex *qm, bool countOnly, SolutionBatch *batch, SearchLimit *limit, WorkSplitter *splitter)
+    : BoardSize<FixedN>(boardSize), initialState(initial), foundFirst(false), maxDepth(maxDepth), workQueue(wq), queueMutex(qm), countOnly(countOnly), solutionCount(0), batch(batch), limit(limit), splitter(splitter),
+      attacks(FixedN > 0 ? nullptr : AttackTable<Domain>::get(boardSize)) {}
+
+template <typename Domain, int FixedN>
+void BTFCSolver<Domain, FixedN>::reset(const Solution &initial)
+{
+    initialState = initial;
+    solutions.clear();
+    solutionCount = 0;
+    foundFirst = false;
+    stats.clear();
+}
+
+template <typename Domain, int FixedN>
+typename BTFCSolver<Domain, FixedN>::Domains BTFCSolver<Domain, FixedN>::initializeDomains(const Solution &board, int startRow) const
+{
+    Domains domains = makeRowArray<Domain, FixedN>(n, Domain());
+
+    // initialize all unassigned rows with full domain
+    for (int row = startRow; row < n; row++)
+    {
+        Domain available = Domain::firstN(n);
+
+        // rmove columns that conflict with already assigned vars
+        for (int prevRow = 0; prevRow < row; prevRow++)
+        {
+            if (board[prevRow] != -1)
+            {
+                int prevCol = board[prevRow];
+                // remove columns attacked by this queen using precomputed mask
+                available &= ~attackMask(prevRow, row, prevCol);
+            }
+        }
+
+        domains[row] = available;
+    }
+
+    return domains;
+}
+
+template <typename Domain, int FixedN>
+void BTFCSolver<Domain, FixedN>::solve()
+{
+    std::deque<FCSearchState<Domain, FixedN>> stateStack;
+
+    // find first unassigned row in initial state
+    // can't start at 0, because parallel solvers have diff start states
+    int startRow = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (initialState[i] == -1)
+        {
+            startRow = i;
+            break;
+        }
+    }
+
+    // initialize domains for all unassigned rows
+    Domains initialDomains = initializeDomains(initialState, startRow);
+
+    stateStack.push_back(FCSearchState<Domain, FixedN>(makeBoard<FixedN>(initialState), startRow, initialDomains));
+
+    while (!stateStack.empty())
+    {
+        // another solver claimed the k-th solution, stop here
+        if (limit && limit->stopped())
+            break;
+
+        // an idle worker needs work, hand it the oldest pending state (the one closest to the root)
+        if (splitter && stateStack.size() > 1 && splitter->wanted() && splitter->worthSplitting(n - stateStack.front().row))
+        {
+            splitter->donate(toSolution(stateStack.front().board));
+            stateStack.pop_front();
+        }
+
+        FCSearchState<Domain, FixedN> current = stateStack.back();
+        stateStack.pop_back();
+
+        // if maxDepth is set and we've reached it, add to work queue instead of continuing
+        // this is only used for the seed generator solver
+        if (maxDepth > 0 && current.row == maxDepth)
+        {
+            std::lock_guard<std::mutex> lock(*queueMutex);
+            workQueue->push(toSolution(current.board));
+            continue;
+        }
+
+        // if solution is found
+        if (current.row == n)
+        {
+            // k solutions are already in (maybe from another thread), this one doesn't count
+            if (limit && !limit->claim(current.board))
+                continue;
+
+            solutionCount++;
+            if (batch)
+                batch->add(current.board);
+            else if (!countOnly)
+                solutions.push_back(toSolution(current.board));
+
+            if (!foundFirst)
+            {
+                firstSolutionTime = std::chrono::high_resolution_clock::now();
+                foundFirst = true;
+            }
+            continue;
+        }
+
+        stats.node(current.row);
+
+        Domain domain = current.domains[current.row];
+
+        for (int col = 0; col < n; col++)
+        {
+            if (!domain.test(col))
+                continue; // this value is not in domain
+
+            // forward check
+            // would this assignment wipe out any future domain? if yes, die
+            bool causesWipeout = false;
+
+            for (int futureRow = current.row + 1; futureRow < n; futureRow++)
+            {
+                Domain futureDomain = current.domains[futureRow];
+
+                // remove columns attacked by (row, col) using precomputed mask
+                futureDomain &= ~attackMask(current.row, futureRow, col);
+
+                if (futureDomain.none())
+                {
+                    causesWipeout = true;
+                    break;
+                }
+            }
+
+            if (causesWipeout)
+            {
+                stats.prune();
+                continue;
+            }
+
+            Domains newDomains = current.domains;
+
+            // update domains by remove attacked columns
+            for (int futureRow = current.row + 1; futureRow < n; futureRow++)
+            {
+                newDomains[futureRow] &= ~attackMask(current.row, futureRow, col);
+            }
+
+            Board newBoard = current.board;
+            newBoard[current.row] = col;
+            stateStack.push_back(FCSearchState<Domain, FixedN>(newBoard, current.row + 1, newDomains));
+        }
+        stats.stack(stateStack.size());
+    }
+}
+
+template <typename Domain, int FixedN>
+const std::vector<Solution> &BTFCSolver<Domain, FixedN>::getSolutions() const
+{
+    return solutions;
+}
+
+template <typename Domain, int FixedN>
+std::vector<Solution> BTFCSolver<Domain, FixedN>::takeSolutions()
+{
+    std::vector<Solution> taken;
+    taken.swap(solutions);
+    return taken;
+}
+
+template <typename Domain, int FixedN>
+std::chrono::high_resolution_clock::time_point BTFCSolver<Domain, FixedN>::getFirstSolutionTime() const
+{
+    return firstSolutionTime;
+}
+
+template <typename Domain, int FixedN>
+uint64_t BTFCSolver<Domain, FixedN>::getSolutionCount() const
+{
+    return solutionCount;
+}
+
+template <typename Domain, int FixedN>
+const SearchStats &BTFCSolver<Domain, FixedN>::getStats() const
+{
+    return stats;
+}
+
+INSTANTIATE_FOR_BITSETS(BTFCSolver)
+INSTANTIATE_FOR_FIXED_SIZES(BTFCSolver)
\ No newline at end of file
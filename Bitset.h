@@ -0,0 +1,185 @@
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <cstdint>
+
+// fixed width set of columns, Words * 64 columns wide
+// every op walks all the words with no early exit (except lowest / clearLowest), so for the
+// common Bitset<1> the compiler folds everything down to the same single instructions as a plain uint64_t
+template <int Words>
+struct Bitset
+{
+    uint64_t words[Words];
+
+    static constexpr int WIDTH = Words * 64;
+
+    // empty set
+    constexpr Bitset() : words{} {}
+
+    // {bit}
+    static constexpr Bitset single(int bit)
+    {
+        Bitset result;
+        result.words[bit >> 6] = 1ULL << (bit & 63);
+        return result;
+    }
+
+    // {0, 1, ..., count - 1}, same as (1ULL << count) - 1 but without overflowing at 64
+    static constexpr Bitset firstN(int count)
+    {
+        Bitset result;
+        for (int i = 0; i < Words; i++)
+        {
+            int bits = count - i * 64;
+            result.words[i] = bits >= 64 ? ~0ULL : (bits <= 0 ? 0ULL : (1ULL << bits) - 1);
+        }
+        return result;
+    }
+
+    constexpr bool none() const
+    {
+        uint64_t any = 0;
+        for (int i = 0; i < Words; i++)
+            any |= words[i];
+        return any == 0;
+    }
+
+    constexpr bool any() const { return !none(); }
+
+    constexpr bool test(int bit) const { return (words[bit >> 6] >> (bit & 63)) & 1ULL; }
+    constexpr void set(int bit) { words[bit >> 6] |= 1ULL << (bit & 63); }
+    constexpr void reset(int bit) { words[bit >> 6] &= ~(1ULL << (bit & 63)); }
+
+    int count() const
+    {
+        int total = 0;
+        for (int i = 0; i < Words; i++)
+            total += __builtin_popcountll(words[i]);
+        return total;
+    }
+
+    // index of the lowest set bit, the set must not be empty
+    int lowest() const
+    {
+        for (int i = 0; i < Words - 1; i++)
+        {
+            if (words[i])
+                return i * 64 + __builtin_ctzll(words[i]);
+        }
+        return (Words - 1) * 64 + __builtin_ctzll(words[Words - 1]);
+    }
+
+    // drop the lowest set bit
+    void clearLowest()
+    {
+        for (int i = 0; i < Words; i++)
+        {
+            if (words[i])
+            {
+                words[i] &= words[i] - 1;
+                return;
+            }
+        }
+    }
+
+    // every column moved one up / down, whatever is shifted past either end is dropped
+    constexpr Bitset shiftUp() const
+    {
+        Bitset result;
+        uint64_t carry = 0;
+        for (int i = 0; i < Words; i++)
+        {
+            result.words[i] = (words[i] << 1) | carry;
+            carry = words[i] >> 63;
+        }
+        return result;
+    }
+
+    constexpr Bitset shiftDown() const
+    {
+        Bitset result;
+        uint64_t carry = 0;
+        for (int i = Words - 1; i >= 0; i--)
+        {
+            result.words[i] = (words[i] >> 1) | carry;
+            carry = words[i] << 63;
+        }
+        return result;
+    }
+
+    constexpr Bitset operator&(const Bitset &other) const
+    {
+        Bitset result;
+        for (int i = 0; i < Words; i++)
+            result.words[i] = words[i] & other.words[i];
+        return result;
+    }
+
+    constexpr Bitset operator|(const Bitset &other) const
+    {
+        Bitset result;
+        for (int i = 0; i < Words; i++)
+            result.words[i] = words[i] | other.words[i];
+        return result;
+    }
+
+    constexpr Bitset operator^(const Bitset &other) const
+    {
+        Bitset result;
+        for (int i = 0; i < Words; i++)
+            result.words[i] = words[i] ^ other.words[i];
+        return result;
+    }
+
+    constexpr Bitset operator~() const
+    {
+        Bitset result;
+        for (int i = 0; i < Words; i++)
+            result.words[i] = ~words[i];
+        return result;
+    }
+
+    constexpr Bitset &operator&=(const Bitset &other)
+    {
+        for (int i = 0; i < Words; i++)
+            words[i] &= other.words[i];
+        return *this;
+    }
+
+    constexpr Bitset &operator|=(const Bitset &other)
+    {
+        for (int i = 0; i < Words; i++)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    constexpr Bitset &operator^=(const Bitset &other)
+    {
+        for (int i = 0; i < Words; i++)
+            words[i] ^= other.words[i];
+        return *this;
+    }
+
+    constexpr bool operator==(const Bitset &other) const
+    {
+        uint64_t diff = 0;
+        for (int i = 0; i < Words; i++)
+            diff |= words[i] ^ other.words[i];
+        return diff == 0;
+    }
+
+    constexpr bool operator!=(const Bitset &other) const { return !(*this == other); }
+};
+
+// widest board the bitset solvers can take, spawnSolver picks the narrowest width that fits
+constexpr int MAX_BITSET_BOARD = 1024;
+
+// the bitset solvers are templates defined in their .cpp, this instantiates one per supported width
+#define INSTANTIATE_FOR_BITSETS(TEMPLATE) \
+    template class TEMPLATE<Bitset<1>>;   \
+    template class TEMPLATE<Bitset<2>>;   \
+    template class TEMPLATE<Bitset<4>>;   \
+    template class TEMPLATE<Bitset<8>>;   \
+    template class TEMPLATE<Bitset<16>>;
+
+#endif
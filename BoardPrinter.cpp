@@ -0,0 +1,94 @@
+#include "BoardPrinter.h"
+
+// flush to the stream once this much text has piled up
+static constexpr size_t WRITE_CHUNK = 1 << 20;
+
+BoardPrinter::BoardPrinter(std::ostream &out, int boardSize, bool mirrored, size_t maxPending)
+    : out(out), n(boardSize), mirrored(mirrored), maxPending(maxPending), closing(false), printed(0)
+{
+    for (int col = 0; col < n; col++)
+        emptyRow += ". ";
+    emptyRow += "\n";
+
+    buffer.reserve(WRITE_CHUNK + 4096);
+    writer = std::thread(&BoardPrinter::writeLoop, this);
+}
+
+BoardPrinter::~BoardPrinter()
+{
+    close();
+}
+
+void BoardPrinter::consume(std::vector<int> &&cells)
+{
+    std::unique_lock<std::mutex> lock(pendingMutex);
+    notFull.wait(lock, [this]() { return pending.size() < maxPending; });
+    pending.push_back(std::move(cells));
+    notEmpty.notify_one();
+}
+
+void BoardPrinter::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        if (closing)
+            return;
+        closing = true;
+    }
+    notEmpty.notify_one();
+    writer.join();
+}
+
+// same layout printSolution uses
+void BoardPrinter::render(const int *board, bool flip)
+{
+    buffer += "Solution ";
+    buffer += std::to_string(++printed);
+    buffer += ":\n";
+
+    for (int row = 0; row < n; row++)
+    {
+        int col = flip ? n - 1 - board[row] : board[row];
+        size_t start = buffer.size();
+        buffer += emptyRow;
+        buffer[start + 2 * col] = 'Q';
+    }
+    buffer += "\n";
+}
+
+void BoardPrinter::writeLoop()
+{
+    while (true)
+    {
+        std::vector<int> cells;
+        {
+            std::unique_lock<std::mutex> lock(pendingMutex);
+            notEmpty.wait(lock, [this]() { return closing || !pending.empty(); });
+
+            // only stop once everything queued before close() is out
+            if (pending.empty())
+                break;
+
+            cells = std::move(pending.front());
+            pending.pop_front();
+        }
+        notFull.notify_one();
+
+        for (size_t start = 0; start + n <= cells.size(); start += n)
+        {
+            render(&cells[start], false);
+            if (mirrored)
+                render(&cells[start], true);
+
+            if (buffer.size() >= WRITE_CHUNK)
+            {
+                out.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
+        }
+    }
+
+    out.write(buffer.data(), buffer.size());
+    buffer.clear();
+    out.flush();
+}
@@ -0,0 +1,51 @@
+#ifndef BOARDPRINTER_H
+#define BOARDPRINTER_H
+
+#include "SolutionSink.h"
+#include <ostream>
+#include <string>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstdint>
+
+// renders boards as text on its own thread, so formatting and writing overlap with the search
+// at most maxPending batches wait for the writer, solver threads block on consume when it falls behind,
+// so memory stays bounded no matter how many solutions there are
+class BoardPrinter : public SolutionSink
+{
+private:
+    std::ostream &out;
+    int n;
+    bool mirrored; // also print every board flipped left to right (symmetry MIRROR only searches half)
+    size_t maxPending;
+
+    std::mutex pendingMutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<std::vector<int>> pending;
+    bool closing;
+
+    uint64_t printed;
+    std::string buffer;   // output is built here and handed to out in big writes
+    std::string emptyRow; // ". . . " for one row, copied and patched per queen
+    std::thread writer;
+
+    void writeLoop();
+    void render(const int *board, bool flip);
+
+public:
+    BoardPrinter(std::ostream &out, int boardSize, bool mirrored = false, size_t maxPending = 8);
+    ~BoardPrinter();
+
+    BoardPrinter(const BoardPrinter &) = delete;
+    BoardPrinter &operator=(const BoardPrinter &) = delete;
+
+    void consume(std::vector<int> &&cells) override;
+
+    // wait until every batch handed in so far has been written, then stop the writer
+    void close();
+};
+
+#endif
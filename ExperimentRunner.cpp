@@ -1,258 +1,789 @@
-#include "ExperimentRunner.h"
-#include <atomic>
-
-double getCurrentMemoryUsageMB()
-{
-    PROCESS_MEMORY_COUNTERS pmc;
-    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
-    {
-        return pmc.WorkingSetSize / (1024.0 * 1024.0);
-    }
-    return 0.0;
-}
-
-double getCpuTime() {
-    FILETIME creation, exit, kernel, user;
-    if (GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
-        ULARGE_INTEGER k, u;
-        k.LowPart = kernel.dwLowDateTime;
-        k.HighPart = kernel.dwHighDateTime;
-        u.LowPart = user.dwLowDateTime;
-        u.HighPart = user.dwHighDateTime;
-
-        return (double)(k.QuadPart + u.QuadPart) * 1e-7;
-    }
-    return 0;
-}
-
-void printConfig(const Config &config)
-{
-    std::cout << "N-Queens Solver" << "\n";
-    std::cout << "- Solver: " << config.solverType << "\n";
-    std::cout << "- Board Size: " << config.boardSize << "\n";
-    std::cout << "- Parallel: " << (config.isParallel ? "Yes" : "No") << "\n";
-    if (config.isParallel)
-    {
-        std::cout << "- Threads: " << config.nThreads << "\n";
-        std::cout << "- Domain Granularity: " << config.domainGranularity << "\n";
-    }
-    std::cout << "\n";
-}
-
-// spawn solver based on config
-// maxDepth is used for filling out the domain at the start
-std::unique_ptr<Solver> spawnSolver(const std::string &solverType, int boardSize, const Solution &initialState, int maxDepth = 0,
-                                    std::queue<Solution> *workQueue = nullptr, std::mutex *queueMutex = nullptr)
-{
-    if (solverType == "BT")
-    {
-        return std::make_unique<BTSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex);
-    }
-    else if (solverType == "BT-FC")
-    {
-        return std::make_unique<BTFCSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex);
-    }
-    else if (solverType == "BT-FC-DVO")
-    {
-        return std::make_unique<BTFCDVOSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex);
-    }
-    else if (solverType == "AC3")
-    {
-        return std::make_unique<AC3Solver>(boardSize, initialState, maxDepth, workQueue, queueMutex);
-    }
-    else if (solverType == "AC3-DVO")
-    {
-        return std::make_unique<AC3DVOSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex);
-    }
-
-    std::cout << "Error while spawning solver! Are you sure you typed in a valid type?\n";
-    return nullptr;
-}
-// https://stackoverflow.com/questions/12347371/stdput-time-formats
-std::string getCurrentTimestamp()
-{
-    // when to use auto vs time t?
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    std::tm tm = *std::localtime(&time);
-
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%Y-%m-%d-%H-%M-%S");
-    return oss.str();
-}
-
-void printSolution(const Solution &sol)
-{
-    for (int row = 0; row < sol.size(); row++)
-    {
-        for (int col = 0; col < sol.size(); col++)
-        {
-            std::cout << (sol[row] == col ? "Q " : ". ");
-        }
-        std::cout << "\n";
-    }
-    std::cout << "\n";
-}
-
-
-// pop from primary work queue + allocate solver + start solve + loop if work queue not empty
-void workerThread(std::queue<Solution> *workQueue, std::mutex *queueMutex, const Config &config, std::vector<std::unique_ptr<Solver>> *solvers, std::mutex *solversMutex)
-{
-    while (true)
-    {
-        Solution initialState;
-
-        // pop work from queue
-        {
-            std::lock_guard<std::mutex> lock(*queueMutex);
-            if (workQueue->empty())
-            {
-                break; // wq empty
-            }
-            initialState = workQueue->front();
-            workQueue->pop();
-        }
-
-        auto solver = spawnSolver(config.solverType, config.boardSize, initialState);
-        solver->solve();
-
-        // double check if locking is proper
-        {
-            std::lock_guard<std::mutex> lock(*solversMutex);
-            solvers->push_back(std::move(solver));
-        }
-    }
-}
-
-
-
-ExperimentResult runExperiment(const Config& config) {
-
-    printConfig(config);
-
-
-    std::atomic<bool> running = true;
-    double peakMemoryMB = 0.0;
-
-    std::thread monitor([&]() {
-        double localPeak = 0.0;
-        while (running.load()) {
-            double mem = getCurrentMemoryUsageMB();
-            if (mem > localPeak)
-                localPeak = mem;
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // polling interval
-        }
-        peakMemoryMB = localPeak;
-    });
-
-    auto startTime = std::chrono::high_resolution_clock::now();
-    std::vector<Solution> allSolutions;
-    std::chrono::high_resolution_clock::time_point firstSolutionTime;
-    double startCpuTime = getCpuTime();
-
-    // if threads > 1, make work queue, init a solver with depth = domainGrnularity to populate wq
-    // then, init nThreads workThreads
-    if (config.isParallel)
-    {
-        std::queue<Solution> workQueue;
-        std::mutex queueMutex;
-
-        Solution baseState(config.boardSize, -1);
-        auto seedSolver = spawnSolver(config.solverType, config.boardSize, baseState,
-                                      config.domainGranularity, &workQueue, &queueMutex);
-        seedSolver->solve();
-
-        std::cout << "Work queue populated with " << workQueue.size() << " initial states\n \n";
-
-        std::vector<std::unique_ptr<Solver>> solvers;
-        std::mutex solversMutex;
-        std::vector<std::thread> threads;
-        for (int i = 0; i < config.nThreads; i++)
-        {
-            threads.emplace_back(workerThread, &workQueue, &queueMutex, std::ref(config), &solvers, &solversMutex);
-        }
-
-        for (auto &thread : threads)
-        {
-            thread.join();
-        }
-
-        // compile solutions from all solvers
-        bool foundFirst = false;
-        for (auto &solver : solvers)
-        {
-            // std::vector<Solution> &solutions = solver->getSolutions();
-            const std::vector<Solution> &solutions = solver->getSolutions();
-            allSolutions.insert(allSolutions.end(), solutions.begin(), solutions.end());
-
-            // yoink the fastest first sol from all solvers
-
-            // you have to check if solutions empty, bc otherwise, it crashes if nStates < initial domains,
-            // or the initial domain it gets ends up being a dead end
-            // if (!foundFirst)
-            if (!foundFirst && !solutions.empty())
-            {
-                firstSolutionTime = solver->getFirstSolutionTime();
-                foundFirst = true;
-            }
-            else if (!solutions.empty())
-            {
-                if (solver->getFirstSolutionTime() < firstSolutionTime)
-                    firstSolutionTime = solver->getFirstSolutionTime();
-            }
-        }
-    }
-
-    // if NOT PARALLEL, just run solver plainly, with seed domain of empty board
-    else
-    {
-        Solution initialState(config.boardSize, -1);
-        auto solver = spawnSolver(config.solverType, config.boardSize, initialState);
-        solver->solve();
-
-        allSolutions = solver->getSolutions();
-        firstSolutionTime = solver->getFirstSolutionTime();
-    }
-
-    auto endTime = std::chrono::high_resolution_clock::now();
-    double endCpuTime = getCpuTime();
-    double elapsedCpuTime = endCpuTime - startCpuTime;
-
-    running = false;
-    monitor.join();
-    
-
-    double timeToFirst = std::chrono::duration<double>(firstSolutionTime - startTime).count();
-    double timeToAll = std::chrono::duration<double>(endTime - startTime).count();
-
-    // results
-    std::cout << "Time to First Solution: " << timeToFirst << " seconds\n";
-    std::cout << "Time to All Solutions: " << timeToAll << " seconds\n";
-    std::cout << "CPU Time Used: " << elapsedCpuTime << " seconds\n";
-    std::cout << "Peak Memory Usage: " << peakMemoryMB << " MB\n";
-
-    std::cout << "Number of Solutions: " << allSolutions.size() << "\n\n";
-    
-    if (config.printAllSolutions)
-    {
-        std::cout << "All Solutions: \n\n";
-        for (size_t i = 0; i < allSolutions.size(); i++)
-        {
-            std::cout << "Solution " << (i + 1) << ":\n";
-            printSolution(allSolutions[i]);
-        }
-    }
-
-    return ExperimentResult{
-        startTime,
-        endTime,
-        firstSolutionTime,
-        timeToFirst,
-        timeToAll,
-        elapsedCpuTime,
-        peakMemoryMB,
-        static_cast<int>(allSolutions.size())
-    };
-
+#include "ExperimentRunner.h"
+#include <atomic>
+#include <algorithm>
+
+void printConfig(const Config &config)
+{
+    std::cout << "N-Queens Solver" << "\n";
+    std::cout << "- Solver: " << config.solverType << "\n";
+    std::cout << "- Board Size: " << config.boardSize << "\n";
+    if (config.solverType.rfind("AC3", 0) == 0)
+    {
+        std::cout << "- AC3 Propagation: " << (config.ac3Trail ? "In place (trail)" : "Copy per child") << "\n";
+        std::cout << "- AC3 Revise: " << (config.ac3QueensRevise ? "Queens specific" : "Generic") << "\n";
+        std::cout << "- AC3 Arc Order: " << (config.ac3ArcOrder == "MIN-DOMAIN" ? "Smallest domain first" : "FIFO") << "\n";
+    }
+    std::cout << "- Parallel: " << (config.isParallel ? "Yes" : "No") << "\n";
+    if (config.isParallel)
+    {
+        std::cout << "- Threads: " << config.nThreads << "\n";
+        std::cout << "- Domain Granularity: " << config.domainGranularity << "\n";
+        std::cout << "- Dynamic Splitting: " << (config.dynamicSplit ? "Yes" : "No") << "\n";
+        std::cout << "- Seed Solver: " << config.seedSolver << "\n";
+        std::cout << "- Affinity: " << config.affinity << "\n";
+    }
+    std::cout << "- Symmetry: " << config.symmetry << "\n";
+    std::cout << "- Count Only: " << (config.countOnly ? "Yes" : "No") << "\n";
+    std::cout << "- Solution Store: " << config.solutionStore << "\n";
+    if (config.stopAfter > 0)
+        std::cout << "- Stop After: " << config.stopAfter << " solutions\n";
+    if (config.trace)
+        std::cout << "- Trace: Yes\n";
+    std::cout << "\n";
+}
+
+// bitset solvers come in one instantiation per domain width, pick the narrowest one that fits the board
+template <template <typename> class SolverType, typename... Args>
+std::unique_ptr<Solver> spawnBitsetSolver(int boardSize, Args... args)
+{
+    if (boardSize <= 64)
+        return std::make_unique<SolverType<Bitset<1>>>(boardSize, args...);
+    if (boardSize <= 128)
+        return std::make_unique<SolverType<Bitset<2>>>(boardSize, args...);
+    if (boardSize <= 256)
+        return std::make_unique<SolverType<Bitset<4>>>(boardSize, args...);
+    if (boardSize <= 512)
+        return std::make_unique<SolverType<Bitset<8>>>(boardSize, args...);
+    if (boardSize <= MAX_BITSET_BOARD)
+        return std::make_unique<SolverType<Bitset<16>>>(boardSize, args...);
+
+    std::cout << "Error while spawning solver! Board size " << boardSize << " is wider than " << MAX_BITSET_BOARD << " columns\n";
+    return nullptr;
+}
+
+// board sizes we sweep get a solver specialized at compile time (constant n, std::array state, constexpr attack table)
+// everything else falls back to the generic bitset widths
+template <template <typename, int> class SolverType, typename... Args>
+std::unique_ptr<Solver> spawnFixedSizeSolver(int boardSize, Args... args)
+{
+    switch (boardSize)
+    {
+    case 8:
+        return std::make_unique<SolverType<Bitset<1>, 8>>(boardSize, args...);
+    case 9:
+        return std::make_unique<SolverType<Bitset<1>, 9>>(boardSize, args...);
+    case 10:
+        return std::make_unique<SolverType<Bitset<1>, 10>>(boardSize, args...);
+    case 11:
+        return std::make_unique<SolverType<Bitset<1>, 11>>(boardSize, args...);
+    case 12:
+        return std::make_unique<SolverType<Bitset<1>, 12>>(boardSize, args...);
+    case 13:
+        return std::make_unique<SolverType<Bitset<1>, 13>>(boardSize, args...);
+    case 14:
+        return std::make_unique<SolverType<Bitset<1>, 14>>(boardSize, args...);
+    case 15:
+        return std::make_unique<SolverType<Bitset<1>, 15>>(boardSize, args...);
+    case 16:
+        return std::make_unique<SolverType<Bitset<1>, 16>>(boardSize, args...);
+    case 17:
+        return std::make_unique<SolverType<Bitset<1>, 17>>(boardSize, args...);
+    case 18:
+        return std::make_unique<SolverType<Bitset<1>, 18>>(boardSize, args...);
+    case 19:
+        return std::make_unique<SolverType<Bitset<1>, 19>>(boardSize, args...);
+    case 20:
+        return std::make_unique<SolverType<Bitset<1>, 20>>(boardSize, args...);
+    }
+
+    return spawnBitsetSolver<SolverType>(boardSize, args...);
+}
+
+// boards go into tries fed from the solution batches, the solvers themselves don't keep them
+bool usesTrie(const Config &config)
+{
+    return config.solutionStore == "TRIE" && !config.countOnly && config.symmetry != "FUNDAMENTAL";
+}
+
+// fundamental solutions are picked from the boards after the search, so that mode always needs them
+bool storesSolutions(const Config &config)
+{
+    return (!config.countOnly && !usesTrie(config)) || config.symmetry == "FUNDAMENTAL";
+}
+
+// the solver that expands seeds, the main one unless config.seedSolver picks another
+// BT, BT-FC and AC3 only start from boards whose top rows are filled in, the DVO seeders don't make those
+std::string seedSolverType(const Config &config)
+{
+    const std::string &seeder = config.seedSolver;
+    if (seeder == "SAME" || seeder == config.solverType)
+        return config.solverType;
+
+    bool prefixSeeds = seeder == "BT" || seeder == "BT-BITS" || seeder == "BT-FC" || seeder == "AC3";
+    bool known = prefixSeeds || seeder == "BT-FC-DVO" || seeder == "AC3-DVO";
+    bool takesAnyBoard = config.solverType == "BT-BITS" || config.solverType == "BT-FC-DVO" || config.solverType == "AC3-DVO";
+    if (!known || (!prefixSeeds && !takesAnyBoard))
+    {
+        std::cout << "Seed solver " << seeder << " can't seed " << config.solverType << ", seeding with " << config.solverType << " instead\n";
+        return config.solverType;
+    }
+    return seeder;
+}
+
+// spawn solver based on config
+// maxDepth is used for filling out the domain at the start
+std::unique_ptr<Solver> spawnSolver(const Config &config, const Solution &initialState, int maxDepth = 0,
+                                    std::queue<Solution> *workQueue = nullptr, std::mutex *queueMutex = nullptr, SolutionBatch *batch = nullptr,
+                                    SearchLimit *limit = nullptr, WorkSplitter *splitter = nullptr)
+{
+    const std::string &solverType = config.solverType;
+    int boardSize = config.boardSize;
+    bool countOnly = !storesSolutions(config);
+    ArcOrder arcOrder = config.ac3ArcOrder == "MIN-DOMAIN" ? ArcOrder::SmallestDomain : ArcOrder::Fifo;
+
+    if (solverType == "BT")
+    {
+        return std::make_unique<BTSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex, countOnly, batch, limit, splitter);
+    }
+    else if (solverType == "BT-BITS")
+    {
+        return spawnBitsetSolver<BTBitsSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex, countOnly, batch, limit, splitter);
+    }
+    else if (solverType == "BT-FC")
+    {
+        return spawnFixedSizeSolver<BTFCSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex, countOnly, batch, limit, splitter);
+    }
+    else if (solverType == "BT-FC-DVO")
+    {
+        return spawnFixedSizeSolver<BTFCDVOSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex, countOnly, batch, limit, splitter);
+    }
+    else if (solverType == "AC3")
+    {
+        return spawnFixedSizeSolver<AC3Solver>(boardSize, initialState, maxDepth, workQueue, queueMutex, countOnly, batch, limit, splitter, config.ac3Trail, config.ac3QueensRevise, arcOrder);
+    }
+    else if (solverType == "AC3-DVO")
+    {
+        return spawnFixedSizeSolver<AC3DVOSolver>(boardSize, initialState, maxDepth, workQueue, queueMutex, countOnly, batch, limit, splitter, config.ac3Trail, config.ac3QueensRevise, arcOrder);
+    }
+
+    std::cout << "Error while spawning solver! Are you sure you typed in a valid type?\n";
+    return nullptr;
+}
+// https://stackoverflow.com/questions/12347371/stdput-time-formats
+std::string getCurrentTimestamp()
+{
+    // when to use auto vs time t?
+    auto now = std::chrono::system_clock::now();
+    auto time = std::chrono::system_clock::to_time_t(now);
+    std::tm tm = *std::localtime(&time);
+
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%Y-%m-%d-%H-%M-%S");
+    return oss.str();
+}
+
+void printSolution(const Solution &sol)
+{
+    for (int row = 0; row < sol.size(); row++)
+    {
+        for (int col = 0; col < sol.size(); col++)
+        {
+            std::cout << (sol[row] == col ? "Q " : ". ");
+        }
+        std::cout << "\n";
+    }
+    std::cout << "\n";
+}
+
+
+// what's left of the solvers once their seeds are done, added up after every seed so no solver has to outlive its seed
+// every worker has its own (padded out to its own cache line, workers never write next to each other), after the
+// join they're merged
+// solutions are never copied on the way: every seed's vector is moved out of its solver as a chunk of its own, and
+// merging moves whole chunks, so it's O(seeds with solutions) however many solutions there are
+struct alignas(64) SearchResults
+{
+    std::vector<std::vector<Solution>> chunks; // solutions, one chunk per seed that found any
+    uint64_t solutionCount = 0;
+    SearchStats stats;
+    bool foundFirst = false;
+    std::chrono::high_resolution_clock::time_point firstSolutionTime;
+    double cpuTime = 0; // of the worker thread, set once it's out of work
+
+    void harvest(Solver &solver)
+    {
+        std::vector<Solution> found = solver.takeSolutions();
+        if (!found.empty())
+            chunks.push_back(std::move(found));
+        solutionCount += solver.getSolutionCount();
+        stats.merge(solver.getStats());
+
+        // yoink the fastest first sol from all solvers
+        // only check solvers that found something, a seed can be a dead end and then there's no first solution time
+        if (solver.getSolutionCount() > 0 && (!foundFirst || solver.getFirstSolutionTime() < firstSolutionTime))
+        {
+            firstSolutionTime = solver.getFirstSolutionTime();
+            foundFirst = true;
+        }
+    }
+
+    void merge(SearchResults &other)
+    {
+        for (std::vector<Solution> &chunk : other.chunks)
+            chunks.push_back(std::move(chunk));
+        solutionCount += other.solutionCount;
+        stats.merge(other.stats);
+        cpuTime += other.cpuTime;
+
+        if (other.foundFirst && (!foundFirst || other.firstSolutionTime < firstSolutionTime))
+        {
+            firstSolutionTime = other.firstSolutionTime;
+            foundFirst = true;
+        }
+    }
+};
+
+// take a seed from this worker's deque (or steal one) + reset this thread's solver to it + solve + loop until the pool is done
+// seeds shallower than seedDepth are expanded by one row with seedConfig's solver instead, so seeding runs on every
+// worker and overlaps with the search (the first seeds are being solved while other workers still expand theirs)
+// a worker takes its newest seed first, so the seed tree is walked depth first and seeds are only made as they're
+// needed, a deque never holds much more than granularity * n of them however many seeds there are in total
+void workerThread(WorkStealingPool *pool, int worker, const Config &config, const Config &seedConfig, int seedDepth,
+                  SearchResults *results,
+                  SolutionSink *sink, SolutionTrie *trie, SearchLimit *limit, std::atomic<uint64_t> *seedCount, const LogicalCpu *cpu,
+                  TraceBuffer *trace)
+{
+    // first thing, so everything this thread allocates comes from its own numa node
+    if (cpu && !pinCurrentThread(*cpu))
+        std::cout << "Worker " << worker << " could not be pinned to cpu " << cpu->index << "\n";
+    double startCpuTime = getThreadCpuTime();
+
+    // boards go to the shared sink and / or this thread's own trie (only ever touched from here, so no locking)
+    SinkFanout outputs;
+    if (sink)
+        outputs.add(sink);
+    if (trie)
+        outputs.add(trie);
+
+    // when streaming, every solver this thread runs shares one batch, whatever is left is flushed when the thread ends
+    std::unique_ptr<SolutionBatch> batch;
+    if (!outputs.empty())
+        batch = std::make_unique<SolutionBatch>(&outputs, config.boardSize);
+
+    // lets this thread's solvers split work off for idle workers
+    std::unique_ptr<WorkSplitter> splitter;
+    if (config.dynamicSplit)
+        splitter = std::make_unique<WorkSplitter>(pool, worker);
+
+    // one solver per thread, spawned for the first seed and reset() for every one after that
+    std::unique_ptr<Solver> solver;
+
+    // time in next() is a wait span, whether it popped, stole or slept
+    int64_t waitStart = trace ? TraceBuffer::now() : 0;
+
+    // searches seed to the end with this thread's solver
+    auto search = [&](const Solution &seed)
+    {
+        int64_t start = trace ? TraceBuffer::now() : 0;
+        if (solver)
+            solver->reset(seed);
+        else
+            solver = spawnSolver(config, seed, 0, nullptr, nullptr, batch.get(), limit, splitter.get());
+        solver->solve();
+
+        if (trace)
+            trace->record("solve", start, TraceBuffer::now(), solver->getSolutionCount(), &seed);
+
+        // the first k solutions are in, whatever is left in the pool doesn't matter anymore
+        if (limit && limit->stopped())
+            pool->cancel();
+
+        results->harvest(*solver);
+    };
+
+    Solution initialState;
+    while (pool->next(worker, initialState))
+    {
+        int64_t start = trace ? TraceBuffer::now() : 0;
+        if (trace)
+            trace->record("wait", waitStart, start);
+
+        int depth = static_cast<int>(std::count_if(initialState.begin(), initialState.end(), [](int col) { return col != -1; }));
+        if (depth < seedDepth)
+        {
+            std::queue<Solution> children;
+            std::mutex childrenMutex;
+            auto seeder = spawnSolver(seedConfig, initialState, depth + 1, &children, &childrenMutex);
+            seeder->solve();
+
+            // children go on this worker's own deque, it carries on with the newest while idle workers steal the rest
+            // once the deque is full the rest stay here and get searched right away
+            size_t made = children.size();
+            if (depth + 1 == seedDepth)
+                seedCount->fetch_add(made);
+            while (!children.empty() && pool->tryPush(worker, children.front()))
+                children.pop();
+
+            if (trace)
+                trace->record("expand", start, TraceBuffer::now(), made, &initialState);
+
+            // for its revise calls
+            results->harvest(*seeder);
+
+            // initialState isn't done until its overflow is, so the pool can't run dry while this still has work
+            for (; !children.empty() && !(limit && limit->stopped()); children.pop())
+                search(children.front());
+            pool->done();
+
+            if (trace)
+                waitStart = TraceBuffer::now();
+            continue;
+        }
+
+        search(initialState);
+        pool->done();
+
+        if (trace)
+            waitStart = TraceBuffer::now();
+    }
+
+    // the last wait is for the other workers to finish
+    if (trace)
+        trace->record("wait", waitStart, TraceBuffer::now());
+
+    results->cpuTime = getThreadCpuTime() - startCpuTime;
+}
+
+
+
+ExperimentResult runExperiment(const Config& config) {
+
+    printConfig(config);
+
+    // no solver can be spawned for a board this wide (and seeds pack their columns into 16 bits), so nothing runs
+    if (config.boardSize > MAX_BITSET_BOARD)
+    {
+        std::cout << "Board size " << config.boardSize << " is wider than " << MAX_BITSET_BOARD << " columns, nothing to run\n";
+        return ExperimentResult{};
+    }
+
+
+    std::atomic<bool> running = true;
+    double peakMemoryMB = 0.0;
+    bool osPeak = resetPeakMemoryUsage();
+
+    std::thread monitor([&]() {
+        double localPeak = 0.0;
+        while (running.load()) {
+            double mem = getCurrentMemoryUsageMB();
+            if (mem > localPeak)
+                localPeak = mem;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // polling interval
+        }
+        peakMemoryMB = localPeak;
+    });
+
+    // recorded with the results, speedups only compare between runs on the same kind of machine
+    CpuTopology topology = CpuTopology::detect();
+
+    // one ring per worker plus main's (the first one), timestamps are relative to the start of the run
+    int64_t traceStart = TraceBuffer::now();
+    std::vector<std::unique_ptr<TraceBuffer>> traces;
+    if (config.trace)
+    {
+        traces.push_back(std::make_unique<TraceBuffer>("main"));
+        for (int i = 0; config.isParallel && i < config.nThreads; i++)
+            traces.push_back(std::make_unique<TraceBuffer>("worker " + std::to_string(i)));
+    }
+    TraceBuffer *mainTrace = traces.empty() ? nullptr : traces.front().get();
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    SearchResults results;
+    uint64_t splits = 0;
+
+    // parallel only, how many seeds the workers made and with which solver, known once they're joined
+    uint64_t seeds = 0;
+    std::string seededBy;
+    double startCpuTime = getCpuTime();
+
+    // cpu time of every worker (or the one search thread) and the wall time they had for it
+    std::vector<double> workerCpuTimes;
+    double searchTime = 0;
+
+    // with symmetry on, only the boards under the mirror roots are searched and the other half is mirrored afterwards
+    bool mirrored = config.symmetry != "NONE" && config.boardSize > 1;
+    std::vector<Solution> roots = mirrored ? mirrorRoots(config.boardSize) : std::vector<Solution>{Solution(config.boardSize, -1)};
+
+    // printed / saved solutions are streamed out while the search runs, except fundamental ones which are only known at the end
+    bool streamed = config.symmetry != "FUNDAMENTAL";
+    SinkFanout sinks;
+
+    std::unique_ptr<BoardPrinter> printer;
+    if (config.printAllSolutions && streamed)
+    {
+        std::cout << "All Solutions: \n\n";
+        printer = std::make_unique<BoardPrinter>(std::cout, config.boardSize, mirrored);
+        sinks.add(printer.get());
+    }
+
+    std::string solutionsPath;
+    std::unique_ptr<SolutionFileWriter> solutionFile;
+    if (config.saveSolutionsToTxt)
+    {
+        solutionsPath = "solutions-" + config.solverType + "-" + std::to_string(config.boardSize) + "-" + getCurrentTimestamp() + ".nqs";
+        solutionFile = std::make_unique<SolutionFileWriter>(solutionsPath, config.boardSize, streamed && mirrored);
+
+        // same as the trace, a file that can't be written is reported and the run goes on without it
+        if (!solutionFile->good())
+        {
+            std::cout << "Could not open " << solutionsPath << ", solutions won't be saved\n";
+            solutionFile.reset();
+            solutionsPath.clear();
+        }
+        else if (streamed)
+            sinks.add(solutionFile.get());
+    }
+
+    SolutionSink *sink = sinks.empty() ? nullptr : &sinks;
+
+    // with the TRIE store every worker builds its own trie, they're merged into this one after the search
+    std::unique_ptr<SolutionTrie> store;
+    if (usesTrie(config))
+        store = std::make_unique<SolutionTrie>(config.boardSize);
+
+    // first-k mode, shared by every solver of the search (the seed generators never find solutions)
+    // a mirrored search finds two solutions per board, so it can stop after half of them
+    // a fundamental one only claims canonical boards, each stands for at least the two boards of a mirror pair too
+    std::unique_ptr<SearchLimit> limit;
+    if (config.stopAfter > 0)
+        limit = std::make_unique<SearchLimit>(mirrored ? (config.stopAfter + 1) / 2 : config.stopAfter,
+                                              config.symmetry == "FUNDAMENTAL");
+
+    // if threads > 1, spread the roots over the workers' deques and init nThreads workThreads
+    // the workers expand the roots row by row until domainGranularity rows are filled in, then solve those seeds
+    if (config.isParallel)
+    {
+        Config seedConfig = config;
+        seedConfig.solverType = seedSolverType(config);
+
+        // seeds keep at least the last row open, a full board as a seed would be searched again from the top
+        // (BT's isSafe only looks at the rows above), a root that is already as deep is a seed by itself
+        int seedDepth = std::max(0, std::min(config.domainGranularity, config.boardSize - 1));
+        std::atomic<uint64_t> seedCount(0);
+        for (const Solution &root : roots)
+        {
+            int rootDepth = static_cast<int>(std::count_if(root.begin(), root.end(), [](int col) { return col != -1; }));
+            if (rootDepth >= seedDepth)
+                seedCount++;
+        }
+
+        WorkStealingPool pool(config.nThreads);
+        pool.distribute(roots);
+
+        // worker i runs on placement[i % size], empty = not pinned
+        std::vector<LogicalCpu> placement = workerPlacement(topology, config.affinity);
+        if (!placement.empty())
+        {
+            std::cout << "Workers pinned to cpus:";
+            for (int i = 0; i < config.nThreads; i++)
+                std::cout << " " << placement[i % placement.size()].index;
+            std::cout << "\n";
+        }
+
+        auto searchStart = std::chrono::high_resolution_clock::now();
+        std::vector<SearchResults> workerResults(config.nThreads);
+        std::vector<std::unique_ptr<SolutionTrie>> tries;
+        std::vector<std::thread> threads;
+        for (int i = 0; i < config.nThreads; i++)
+        {
+            if (store)
+                tries.push_back(std::make_unique<SolutionTrie>(config.boardSize));
+            SolutionTrie *trie = store ? tries.back().get() : nullptr;
+            threads.emplace_back(workerThread, &pool, i, std::ref(config), std::ref(seedConfig), seedDepth, &workerResults[i],
+                                 sink, trie, limit.get(), &seedCount, placement.empty() ? nullptr : &placement[i % placement.size()],
+                                 traces.empty() ? nullptr : traces[i + 1].get());
+        }
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        searchTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - searchStart).count();
+        splits = pool.donations();
+
+        int64_t mergeStart = mainTrace ? TraceBuffer::now() : 0;
+
+        for (SearchResults &worker : workerResults)
+        {
+            workerCpuTimes.push_back(worker.cpuTime);
+            results.merge(worker);
+        }
+
+        seeds = seedCount.load();
+        seededBy = seedConfig.solverType;
+
+        // the first worker's trie becomes the store, the others are freed as soon as they're merged into it
+        for (size_t i = 0; i < tries.size(); i++)
+        {
+            tries[i]->finish();
+            if (i == 0)
+                store = std::move(tries[i]);
+            else
+                store->merge(*tries[i]);
+            tries[i].reset();
+        }
+        if (store)
+            store->finish();
+
+        if (mainTrace)
+            mainTrace->record("merge", mergeStart, TraceBuffer::now(), config.nThreads);
+    }
+
+    // if NOT PARALLEL, just run solver plainly, with seed domain of empty board (or one solver per mirror root)
+    else
+    {
+        SinkFanout outputs;
+        if (sink)
+            outputs.add(sink);
+        if (store)
+            outputs.add(store.get());
+
+        std::unique_ptr<SolutionBatch> batch;
+        if (!outputs.empty())
+            batch = std::make_unique<SolutionBatch>(&outputs, config.boardSize);
+
+        auto searchStart = std::chrono::high_resolution_clock::now();
+        double searchStartCpu = getThreadCpuTime();
+        std::unique_ptr<Solver> solver;
+        for (const Solution &root : roots)
+        {
+            if (limit && limit->stopped())
+                break;
+
+            int64_t solveStart = mainTrace ? TraceBuffer::now() : 0;
+            if (solver)
+                solver->reset(root);
+            else
+                solver = spawnSolver(config, root, 0, nullptr, nullptr, batch.get(), limit.get());
+            solver->solve();
+            if (mainTrace)
+                mainTrace->record("solve", solveStart, TraceBuffer::now(), solver->getSolutionCount(), &root);
+            results.harvest(*solver);
+        }
+        searchTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - searchStart).count();
+        workerCpuTimes.push_back(getThreadCpuTime() - searchStartCpu);
+
+        // everything has to be in the store before it's finished
+        batch.reset();
+        if (store)
+            store->finish();
+    }
+
+    std::vector<std::vector<Solution>> allSolutions = std::move(results.chunks);
+    std::chrono::high_resolution_clock::time_point firstSolutionTime = results.firstSolutionTime;
+    uint64_t solutionCount = results.solutionCount;
+    SearchStats stats = std::move(results.stats);
+
+    // put the mirrored half back, or boil everything down to one solution per symmetry group
+    int64_t symmetryStart = mainTrace ? TraceBuffer::now() : 0;
+    uint64_t numberOfSolutions = solutionCount;
+    int numberOfFundamental = 0;
+    if (config.symmetry == "FUNDAMENTAL")
+    {
+        std::vector<Solution> fundamental;
+        numberOfSolutions = 0;
+        for (const std::vector<Solution> &chunk : allSolutions)
+        {
+            for (const Solution &solution : chunk)
+            {
+                if (isCanonical(solution))
+                {
+                    numberOfSolutions += orbitSize(solution);
+                    fundamental.push_back(solution);
+                }
+            }
+        }
+        numberOfFundamental = static_cast<int>(fundamental.size());
+        allSolutions.assign(1, std::move(fundamental));
+    }
+    else if (mirrored)
+    {
+        for (std::vector<Solution> &chunk : allSolutions)
+        {
+            size_t searched = chunk.size();
+            chunk.reserve(searched * 2);
+            for (size_t i = 0; i < searched; i++)
+                chunk.push_back(mirrorSolution(chunk[i]));
+        }
+        numberOfSolutions = solutionCount * 2;
+
+        // mirrored boards come out in reverse order, so they get a trie of their own that's merged in
+        if (store)
+        {
+            SolutionTrie mirroredHalf(config.boardSize);
+            store->forEach([&](const Solution &solution) { mirroredHalf.insert(mirrorSolution(solution)); });
+            mirroredHalf.finish();
+            store->merge(mirroredHalf);
+            store->finish();
+        }
+    }
+
+    // first-k mode reports at most k in every symmetry mode, a mirrored search ends up one mirror image over for
+    // an odd k, and the fundamental solutions found can stand for more than k boards
+    // streamed output and the trie store get boards in pairs, so they can still hold that one extra mirror image
+    if (limit && numberOfSolutions > config.stopAfter)
+    {
+        numberOfSolutions = config.stopAfter;
+        if (config.symmetry == "MIRROR" && !allSolutions.empty() && !allSolutions.back().empty())
+        {
+            uint64_t stored = 0;
+            for (const std::vector<Solution> &chunk : allSolutions)
+                stored += chunk.size();
+            if (stored > config.stopAfter)
+                allSolutions.back().pop_back();
+        }
+    }
+
+    if (mainTrace && config.symmetry != "NONE")
+        mainTrace->record("symmetry", symmetryStart, TraceBuffer::now(), numberOfSolutions);
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double endCpuTime = getCpuTime();
+    double elapsedCpuTime = endCpuTime - startCpuTime;
+
+    // let the writer catch up before the results go to the same stream
+    if (printer)
+        printer->close();
+
+    // only now, a printer still streaming solutions would bury it somewhere in the middle of them
+    if (config.isParallel)
+        std::cout << "Work queue populated with " << seeds << " initial states (seeded by " << seededBy << ")\n \n";
+
+    if (solutionFile)
+    {
+        // fundamental solutions only exist now, the rest were saved during the search
+        if (!streamed)
+        {
+            SolutionBatch batch(solutionFile.get(), config.boardSize);
+            for (const std::vector<Solution> &chunk : allSolutions)
+                for (const Solution &solution : chunk)
+                    batch.add(solution);
+        }
+        solutionFile->close();
+
+        // a full disk only shows up now
+        if (!solutionFile->good())
+        {
+            std::cout << "Could not write " << solutionsPath << ", the file is incomplete\n";
+            solutionsPath.clear();
+        }
+    }
+
+    // written after the clock stopped, a big trace takes a while
+    std::string tracePath;
+    if (!traces.empty())
+    {
+        std::vector<const TraceBuffer *> buffers;
+        for (const std::unique_ptr<TraceBuffer> &trace : traces)
+            buffers.push_back(trace.get());
+
+        tracePath = "trace-" + config.solverType + "-" + std::to_string(config.boardSize) + "-" + getCurrentTimestamp() + ".json";
+        if (!writeChromeTrace(tracePath, buffers, traceStart))
+        {
+            std::cout << "Could not write trace to " << tracePath << "\n";
+            tracePath.clear();
+        }
+    }
+
+    running = false;
+    monitor.join();
+
+    // polling misses anything shorter than the interval, the os's own peak doesn't
+    if (osPeak)
+        peakMemoryMB = std::max(peakMemoryMB, getPeakMemoryUsageMB());
+
+    double workerCpuTime = 0;
+    double minUtilization = 0;
+    double maxUtilization = 0;
+    for (size_t i = 0; i < workerCpuTimes.size(); i++)
+    {
+        double utilization = searchTime > 0 ? workerCpuTimes[i] / searchTime : 0;
+        workerCpuTime += workerCpuTimes[i];
+        minUtilization = i == 0 ? utilization : std::min(minUtilization, utilization);
+        maxUtilization = std::max(maxUtilization, utilization);
+    }
+    double parallelEfficiency = searchTime > 0 && !workerCpuTimes.empty() ? workerCpuTime / (workerCpuTimes.size() * searchTime) : 0;
+
+    double timeToFirst = std::chrono::duration<double>(firstSolutionTime - startTime).count();
+    double timeToAll = std::chrono::duration<double>(endTime - startTime).count();
+    double timeToK = limit && limit->reached() ? std::chrono::duration<double>(limit->getReachedTime() - startTime).count() : timeToAll;
+
+    // results
+    std::cout << "Time to First Solution: " << timeToFirst << " seconds\n";
+    if (limit)
+        std::cout << "Time to First " << config.stopAfter << " Solutions: " << timeToK << " seconds\n";
+    std::cout << "Time to All Solutions: " << timeToAll << " seconds\n";
+    std::cout << "CPU Time Used: " << elapsedCpuTime << " seconds\n";
+    std::cout << "Peak Memory Usage: " << peakMemoryMB << " MB\n";
+    std::cout << "Worker CPU Time: " << workerCpuTime << " seconds (" << parallelEfficiency * 100 << "% of " << workerCpuTimes.size() << " threads * " << searchTime << " seconds)\n";
+    if (config.isParallel)
+    {
+        std::cout << "Worker Utilization:";
+        for (double cpuTime : workerCpuTimes)
+            std::cout << " " << std::fixed << std::setprecision(0) << (searchTime > 0 ? cpuTime / searchTime * 100 : 0) << "%";
+        std::cout << std::defaultfloat << std::setprecision(6) << "\n";
+    }
+    std::cout << "Topology: " << topology.describe() << "\n";
+    if (config.solverType.rfind("AC3", 0) == 0)
+        std::cout << "Revise Calls: " << stats.reviseCalls << "\n";
+    if (SEARCH_STATS)
+    {
+        std::cout << "Nodes: " << stats.nodes << " (" << stats.pruned << " children pruned, max " << stats.maxStack << " pending)\n";
+        if (config.solverType.rfind("AC3", 0) == 0)
+            std::cout << "Wipeouts: " << stats.wipeouts << ", Arc Pushes: " << stats.arcPushes << "\n";
+        std::cout << "Nodes per Depth:";
+        for (uint64_t nodes : stats.nodesPerDepth)
+            std::cout << " " << nodes;
+        std::cout << "\n";
+    }
+    if (config.isParallel && config.dynamicSplit)
+        std::cout << "Dynamic Splits: " << splits << "\n";
+
+    std::cout << "Number of Solutions: " << numberOfSolutions << "\n";
+    if (config.symmetry == "FUNDAMENTAL")
+        std::cout << "Fundamental Solutions: " << numberOfFundamental << "\n";
+    if (store)
+        std::cout << "Solution Store: " << store->size() << " boards in " << store->edgeCount() << " edges, "
+                  << store->memoryBytes() / (1024.0 * 1024.0) << " MB\n";
+    if (!solutionsPath.empty())
+        std::cout << "Solutions saved to " << solutionsPath << "\n";
+    if (!tracePath.empty())
+        std::cout << "Trace saved to " << tracePath << "\n";
+    std::cout << "\n";
+    
+    if (config.printAllSolutions && !printer)
+    {
+        std::cout << "All Solutions: \n\n";
+        size_t index = 0;
+        for (const std::vector<Solution> &chunk : allSolutions)
+        {
+            for (const Solution &solution : chunk)
+            {
+                std::cout << "Solution " << ++index << ":\n";
+                printSolution(solution);
+            }
+        }
+    }
+
+    return ExperimentResult{
+        startTime,
+        endTime,
+        firstSolutionTime,
+        timeToFirst,
+        timeToAll,
+        elapsedCpuTime,
+        peakMemoryMB,
+        numberOfSolutions,
+        stats,
+        numberOfFundamental,
+        timeToK,
+        splits,
+        topology.describe(),
+        workerCpuTime,
+        parallelEfficiency,
+        minUtilization,
+        maxUtilization
+    };
+
 }
\ No newline at end of file
@@ -1,52 +1,112 @@
-#pragma once
-
-#include <iostream>
-#include <iomanip>
-#include <thread>
-#include <string>
-#include <fstream>
-#include <sstream>
-#include <chrono>
-#include <ctime>
-
-#include <memory>
-#include <mutex>
-#include <queue>
-
-#include <windows.h>
-#include <psapi.h>
-
-
-#include "BTSolver.h"
-#include "BTFCSolver.h"
-#include "BTFCDVOSolver.h"
-
-#include "AC3Solver.h"
-#include "AC3DVOSolver.h"
-
-struct Config
-{
-    std::string solverType;
-    int nThreads;
-    int boardSize;
-    bool printAllSolutions;
-    bool printResultsToTxt;
-    bool saveSolutionsToTxt;
-    bool isParallel;
-    int domainGranularity;
-};
-
-struct ExperimentResult {
-    std::chrono::high_resolution_clock::time_point startTime;
-    std::chrono::high_resolution_clock::time_point endTime;
-    std::chrono::high_resolution_clock::time_point firstSolutionTime;
-    
-
-    double timeToFirst;
-    double timeToAll;
-    double cpuTime;
-    double peakMemoryMB;
-    int numberOfSolutions;
-};
-
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <ctime>
+
+#include <memory>
+#include <mutex>
+#include <queue>
+
+#include "Metrics.h"
+
+
+#include "BTSolver.h"
+#include "BTBitsSolver.h"
+#include "BTFCSolver.h"
+#include "BTFCDVOSolver.h"
+
+#include "AC3Solver.h"
+#include "AC3DVOSolver.h"
+
+#include "Symmetry.h"
+#include "BoardPrinter.h"
+#include "SolutionFile.h"
+#include "SolutionTrie.h"
+#include "WorkStealingPool.h"
+#include "Affinity.h"
+#include "Trace.h"
+
+struct Config
+{
+    std::string solverType;
+    int nThreads;
+    int boardSize;
+    bool printAllSolutions;
+    bool printResultsToTxt;
+    bool saveSolutionsToTxt; // binary solution file (see SolutionFile.h), despite the name
+    bool isParallel;
+    int domainGranularity;
+
+    // only count solutions, no solver stores the boards (ignored for symmetry FUNDAMENTAL, which has to look at them)
+    bool countOnly = false;
+
+    // AC3 / AC3-DVO only: propagate in place on one domain array and undo from a trail instead of copying per child
+    bool ac3Trail = false;
+
+    // AC3 / AC3-DVO only: revise() skips arcs whose target row still has more than 3 values (queens specific)
+    bool ac3QueensRevise = false;
+
+    // AC3 / AC3-DVO only: order arcs are revised in, FIFO or MIN-DOMAIN (arcs into the smallest domains first)
+    std::string ac3ArcOrder = "FIFO";
+
+    // NONE, MIRROR (search half the first row and mirror the rest) or FUNDAMENTAL (mirror search,
+    // but only keep one solution per group of 8 rotations / reflections)
+    std::string symmetry = "NONE";
+
+    // where found boards are kept, VECTOR (every solver keeps its own list) or TRIE (one compressed prefix DAG
+    // per worker, merged at the end, see SolutionTrie.h), symmetry FUNDAMENTAL always uses VECTOR
+    std::string solutionStore = "VECTOR";
+
+    // first-k mode: every thread stops as soon as this many solutions were found, 0 = find all of them
+    // (a mirrored search counts every board found twice, and the count reported is never more than this)
+    uint64_t stopAfter = 0;
+
+    // parallel only: busy solvers split their pending subtrees off for idle workers while they search,
+    // so domainGranularity only has to produce enough seeds to get every thread started
+    bool dynamicSplit = false;
+
+    // parallel only: solver type that expands the board to domainGranularity rows, SAME = solverType
+    // (e.g. BT-BITS feeding AC3), BT, BT-FC and AC3 need seeds with the top rows filled in, so no DVO seeders for those
+    std::string seedSolver = "SAME";
+
+    // parallel only: where workers run, NONE (the os decides), CORES (pinned, every physical core before any smt
+    // sibling) or PHYSICAL (pinned, one worker per physical core), see Affinity.h
+    std::string affinity = "NONE";
+
+    // write a chrome trace of the run (trace-<solver>-<n>-<time>.json, open it in ui.perfetto.dev): every worker's
+    // waits, seed expansions and seed solves, and the main thread's merge, see Trace.h
+    bool trace = false;
+};
+
+struct ExperimentResult {
+    std::chrono::high_resolution_clock::time_point startTime;
+    std::chrono::high_resolution_clock::time_point endTime;
+    std::chrono::high_resolution_clock::time_point firstSolutionTime;
+    
+
+    double timeToFirst;
+    double timeToAll;
+    double cpuTime;
+    double peakMemoryMB;
+    uint64_t numberOfSolutions;
+    SearchStats stats;       // every solver's, seeders included, only revise calls unless built with NQUEENS_SEARCH_STATS
+    int numberOfFundamental; // only counted with symmetry FUNDAMENTAL
+    double timeToK;          // first-k mode: wall clock time until the k-th solution was claimed (time to all if there aren't k)
+    uint64_t splits;         // dynamic splitting: seeds handed to idle workers by running solvers
+    std::string topology;    // numa nodes / cores / cpus of the machine the run was on
+
+    // cpu time the workers spent (the search thread when sequential), and that over threads * search wall time,
+    // so 1 = every worker busy all the time, utilization is the same per worker
+    double workerCpuTime;
+    double parallelEfficiency;
+    double minUtilization;
+    double maxUtilization;
+};
+
 ExperimentResult runExperiment(const Config& config);
\ No newline at end of file
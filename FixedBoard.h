@@ -0,0 +1,87 @@
+#ifndef FIXEDBOARD_H
+#define FIXEDBOARD_H
+
+#include "Solver.h"
+#include <array>
+#include <vector>
+#include <type_traits>
+
+// board sizes we sweep get their own instantiation of every bitset solver with FixedN = n
+// anything else uses FixedN = 0, where the size is only known at runtime
+constexpr int MIN_FIXED_BOARD = 8;
+constexpr int MAX_FIXED_BOARD = 20;
+
+// gives the solvers their n, as a compile time constant when FixedN is set so loops over rows can unroll
+template <int FixedN>
+struct BoardSize
+{
+    static constexpr int n = FixedN;
+    explicit BoardSize(int) {}
+};
+
+template <>
+struct BoardSize<0>
+{
+    int n;
+    explicit BoardSize(int boardSize) : n(boardSize) {}
+};
+
+// one T per row, lives inline (std::array) for fixed sizes and on the heap (std::vector) otherwise
+template <typename T, int FixedN>
+using RowArray = typename std::conditional<(FixedN > 0), std::array<T, (FixedN > 0 ? FixedN : 1)>, std::vector<T>>::type;
+
+template <typename T, int FixedN>
+RowArray<T, FixedN> makeRowArray(int n, const T &value)
+{
+    if constexpr (FixedN > 0)
+    {
+        RowArray<T, FixedN> rows;
+        rows.fill(value);
+        return rows;
+    }
+    else
+    {
+        return RowArray<T, FixedN>(n, value);
+    }
+}
+
+template <int FixedN>
+RowArray<int, FixedN> makeBoard(const Solution &solution)
+{
+    if constexpr (FixedN > 0)
+    {
+        RowArray<int, FixedN> board;
+        for (int row = 0; row < FixedN; row++)
+            board[row] = solution[row];
+        return board;
+    }
+    else
+    {
+        return solution;
+    }
+}
+
+// boards leave the solvers (seeds, solutions) as plain Solutions
+template <typename Board>
+Solution toSolution(const Board &board)
+{
+    return Solution(board.begin(), board.end());
+}
+
+// instantiates a bitset solver once per fixed board size, on top of INSTANTIATE_FOR_BITSETS
+#define INSTANTIATE_FOR_FIXED_SIZES(TEMPLATE) \
+    template class TEMPLATE<Bitset<1>, 8>;    \
+    template class TEMPLATE<Bitset<1>, 9>;    \
+    template class TEMPLATE<Bitset<1>, 10>;   \
+    template class TEMPLATE<Bitset<1>, 11>;   \
+    template class TEMPLATE<Bitset<1>, 12>;   \
+    template class TEMPLATE<Bitset<1>, 13>;   \
+    template class TEMPLATE<Bitset<1>, 14>;   \
+    template class TEMPLATE<Bitset<1>, 15>;   \
+    template class TEMPLATE<Bitset<1>, 16>;   \
+    template class TEMPLATE<Bitset<1>, 17>;   \
+    template class TEMPLATE<Bitset<1>, 18>;   \
+    template class TEMPLATE<Bitset<1>, 19>;   \
+    template class TEMPLATE<Bitset<1>, 20>;
+
+#endif
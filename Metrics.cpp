@@ -0,0 +1,125 @@
+#include "Metrics.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <fstream>
+#include <string>
+#endif
+
+#ifdef _WIN32
+
+// FILETIME counts 100ns ticks
+static double toSeconds(const FILETIME &time)
+{
+    ULARGE_INTEGER ticks;
+    ticks.LowPart = time.dwLowDateTime;
+    ticks.HighPart = time.dwHighDateTime;
+    return (double)ticks.QuadPart * 1e-7;
+}
+
+double getCpuTime()
+{
+    FILETIME creation, exit, kernel, user;
+    if (GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+        return toSeconds(kernel) + toSeconds(user);
+    return 0;
+}
+
+double getThreadCpuTime()
+{
+    FILETIME creation, exit, kernel, user;
+    if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+        return toSeconds(kernel) + toSeconds(user);
+    return 0;
+}
+
+double getCurrentMemoryUsageMB()
+{
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return pmc.WorkingSetSize / (1024.0 * 1024.0);
+    return 0.0;
+}
+
+double getPeakMemoryUsageMB()
+{
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return pmc.PeakWorkingSetSize / (1024.0 * 1024.0);
+    return 0.0;
+}
+
+bool resetPeakMemoryUsage() { return false; }
+
+std::tm toUtc(std::time_t time)
+{
+    std::tm tm{};
+    gmtime_s(&tm, &time);
+    return tm;
+}
+
+#else
+
+static double toSeconds(const timeval &time)
+{
+    return time.tv_sec + time.tv_usec * 1e-6;
+}
+
+// "VmRSS:     1234 kB" -> 1234
+static double statusKB(const std::string &field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, field.size(), field) == 0)
+            return std::stod(line.substr(field.size()));
+    }
+    return 0.0;
+}
+
+double getCpuTime()
+{
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+    return 0;
+}
+
+double getThreadCpuTime()
+{
+    timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0)
+        return time.tv_sec + time.tv_nsec * 1e-9;
+    return 0;
+}
+
+double getCurrentMemoryUsageMB()
+{
+    return statusKB("VmRSS:") / 1024.0;
+}
+
+double getPeakMemoryUsageMB()
+{
+    return statusKB("VmHWM:") / 1024.0;
+}
+
+// 5 = reset the peak resident set size (linux 4.0+)
+bool resetPeakMemoryUsage()
+{
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5" << std::flush;
+    return clearRefs.good();
+}
+
+std::tm toUtc(std::time_t time)
+{
+    std::tm tm{};
+    gmtime_r(&time, &tm);
+    return tm;
+}
+
+#endif
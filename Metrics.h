@@ -0,0 +1,27 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <ctime>
+
+// what the runner measures about the process, from the windows api on windows and from getrusage, clock_gettime
+// and /proc/self/status everywhere else
+
+// cpu time (user + system) of the whole process so far, in seconds
+double getCpuTime();
+
+// cpu time of the calling thread so far, in seconds, for per worker utilization
+double getThreadCpuTime();
+
+// resident memory right now
+double getCurrentMemoryUsageMB();
+
+// highest resident memory since resetPeakMemoryUsage(), the os keeps track of it so even short spikes count
+// false if the os can't reset it (windows, old linux kernels), getPeakMemoryUsageMB() is then the peak since the
+// process started, which is useless for every run after the first one in a process
+double getPeakMemoryUsageMB();
+bool resetPeakMemoryUsage();
+
+// std::gmtime without its shared buffer
+std::tm toUtc(std::time_t time);
+
+#endif
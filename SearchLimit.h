@@ -0,0 +1,58 @@
+#ifndef SEARCHLIMIT_H
+#define SEARCHLIMIT_H
+
+#include "Symmetry.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// first-k mode: shared by every solver (and worker thread) of a run, the search stops once k solutions are in
+// solvers claim each solution before recording it, the one that claims the k-th flips the cancel flag and
+// everyone checks that flag once per node, so all threads wind down within a node of each other
+// with canonicalOnly (symmetry FUNDAMENTAL) only canonical boards are claimed, the others would be thrown away after
+// the search anyway, so k of them could otherwise leave nothing at all
+class SearchLimit
+{
+private:
+    uint64_t limit;
+    bool canonicalOnly;
+    std::atomic<uint64_t> claimed;
+    std::atomic<bool> cancelled;
+    std::chrono::high_resolution_clock::time_point reachedTime; // set by whoever claimed the k-th solution
+
+public:
+    explicit SearchLimit(uint64_t k, bool canonicalOnly = false)
+        : limit(k), canonicalOnly(canonicalOnly), claimed(0), cancelled(k == 0) {}
+
+    SearchLimit(const SearchLimit &) = delete;
+    SearchLimit &operator=(const SearchLimit &) = delete;
+
+    // false if k solutions were already claimed (or board isn't canonical and only those count), the caller then
+    // drops this one
+    template <typename Board>
+    bool claim(const Board &board)
+    {
+        if (canonicalOnly && !isCanonical(Solution(board.begin(), board.end())))
+            return false;
+
+        uint64_t index = claimed.fetch_add(1, std::memory_order_relaxed);
+        if (index >= limit)
+            return false;
+
+        if (index + 1 == limit)
+        {
+            reachedTime = std::chrono::high_resolution_clock::now();
+            cancelled.store(true, std::memory_order_release);
+        }
+        return true;
+    }
+
+    bool stopped() const { return cancelled.load(std::memory_order_relaxed); }
+
+    // only meaningful once the threads are joined
+    bool reached() const { return claimed.load() >= limit; }
+    std::chrono::high_resolution_clock::time_point getReachedTime() const { return reachedTime; }
+};
+
+#endif
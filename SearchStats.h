@@ -0,0 +1,91 @@
+#ifndef SEARCHSTATS_H
+#define SEARCHSTATS_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+// search effort counters are only compiled in with -DNQUEENS_SEARCH_STATS, otherwise every call below is an empty
+// inline function and the solvers' hot loops are exactly what they'd be without them
+// revise calls are the exception and stay on in every build, the reviseCalls column is how ac3ArcOrder runs get
+// compared, it costs one increment per revise()
+#ifdef NQUEENS_SEARCH_STATS
+constexpr bool SEARCH_STATS = true;
+#else
+constexpr bool SEARCH_STATS = false;
+#endif
+
+// how much work a search did, so a slower solver can be told apart as more nodes or costlier ones
+struct SearchStats
+{
+    uint64_t nodes = 0;        // partial boards whose children were looked at
+    uint64_t pruned = 0;       // children thrown out before they became nodes (attacked, forward check, wipeout)
+    uint64_t reviseCalls = 0;  // AC3 only
+    uint64_t wipeouts = 0;     // AC3 only: arc consistency emptied a domain
+    uint64_t arcPushes = 0;    // AC3 only: arcs queued for revision
+    size_t maxStack = 0;       // most pending states (or frames, for the in place searches) at once
+    std::vector<uint64_t> nodesPerDepth; // nodes by number of queens on the board
+
+    void node(int depth)
+    {
+        if constexpr (SEARCH_STATS)
+        {
+            nodes++;
+            if (depth >= static_cast<int>(nodesPerDepth.size()))
+                nodesPerDepth.resize(depth + 1);
+            nodesPerDepth[depth]++;
+        }
+    }
+
+    void prune(uint64_t children = 1)
+    {
+        if constexpr (SEARCH_STATS)
+            pruned += children;
+    }
+
+    void revise() { reviseCalls++; }
+
+    void wipeout()
+    {
+        if constexpr (SEARCH_STATS)
+            wipeouts++;
+    }
+
+    void arcPush()
+    {
+        if constexpr (SEARCH_STATS)
+            arcPushes++;
+    }
+
+    void stack(size_t size)
+    {
+        if constexpr (SEARCH_STATS)
+            maxStack = std::max(maxStack, size);
+    }
+
+    // the histogram keeps its size, so a reset solver doesn't grow it again
+    void clear()
+    {
+        nodes = pruned = reviseCalls = wipeouts = arcPushes = 0;
+        maxStack = 0;
+        std::fill(nodesPerDepth.begin(), nodesPerDepth.end(), 0);
+    }
+
+    // maxStack is per solver, so merging keeps the biggest one
+    void merge(const SearchStats &other)
+    {
+        nodes += other.nodes;
+        pruned += other.pruned;
+        reviseCalls += other.reviseCalls;
+        wipeouts += other.wipeouts;
+        arcPushes += other.arcPushes;
+        maxStack = std::max(maxStack, other.maxStack);
+        if (other.nodesPerDepth.size() > nodesPerDepth.size())
+            nodesPerDepth.resize(other.nodesPerDepth.size());
+        for (size_t depth = 0; depth < other.nodesPerDepth.size(); depth++)
+            nodesPerDepth[depth] += other.nodesPerDepth[depth];
+    }
+};
+
+#endif
@@ -0,0 +1,271 @@
+#include "SolutionFile.h"
+#include "BoardPrinter.h"
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const char SOLUTION_FILE_MAGIC[8] = {'N', 'Q', 'S', 'O', 'L', 'S', '1', '\0'};
+
+// bits needed to hold any column of the board
+static uint32_t bitsForColumns(int boardSize)
+{
+    uint32_t bits = 1;
+    while ((1 << bits) < boardSize)
+        bits++;
+    return bits;
+}
+
+SolutionFileWriter::SolutionFileWriter(const std::string &path, int boardSize, bool mirrored)
+    : file(path, std::ios::binary | std::ios::trunc), mirrored(mirrored), closed(false)
+{
+    std::memcpy(header.magic, SOLUTION_FILE_MAGIC, sizeof(header.magic));
+    header.boardSize = static_cast<uint32_t>(boardSize);
+    header.bitsPerRow = bitsForColumns(boardSize);
+    header.bytesPerSolution = (header.bitsPerRow * header.boardSize + 7) / 8;
+    header.reserved = 0;
+    header.count = 0;
+
+    // count gets patched in by close()
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+SolutionFileWriter::~SolutionFileWriter()
+{
+    close();
+}
+
+void SolutionFileWriter::pack(const int *board, bool flip, uint8_t *record) const
+{
+    int n = static_cast<int>(header.boardSize);
+    uint64_t pending = 0; // bits not written to record yet
+    int pendingBits = 0;
+
+    for (int row = 0; row < n; row++)
+    {
+        uint64_t col = static_cast<uint64_t>(flip ? n - 1 - board[row] : board[row]);
+        pending |= col << pendingBits;
+        pendingBits += header.bitsPerRow;
+
+        while (pendingBits >= 8)
+        {
+            *record++ = static_cast<uint8_t>(pending);
+            pending >>= 8;
+            pendingBits -= 8;
+        }
+    }
+
+    if (pendingBits > 0)
+        *record = static_cast<uint8_t>(pending);
+}
+
+void SolutionFileWriter::consume(std::vector<int> &&cells)
+{
+    size_t n = header.boardSize;
+    if (n == 0)
+        return;
+
+    size_t boards = cells.size() / n;
+    size_t copies = mirrored ? 2 : 1;
+    std::vector<uint8_t> chunk(boards * copies * header.bytesPerSolution, 0);
+
+    uint8_t *record = chunk.data();
+    for (size_t i = 0; i < boards; i++)
+    {
+        pack(&cells[i * n], false, record);
+        record += header.bytesPerSolution;
+
+        if (mirrored)
+        {
+            pack(&cells[i * n], true, record);
+            record += header.bytesPerSolution;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(fileMutex);
+    file.write(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+    header.count += boards * copies;
+}
+
+void SolutionFileWriter::close()
+{
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (closed)
+        return;
+    closed = true;
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.close();
+}
+
+SolutionFileReader::SolutionFileReader()
+    : data(nullptr), length(0), header(nullptr),
+#ifdef _WIN32
+      fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr)
+#else
+      fd(-1)
+#endif
+{
+}
+
+SolutionFileReader::~SolutionFileReader()
+{
+    close();
+}
+
+bool SolutionFileReader::open(const std::string &path)
+{
+    close();
+
+#ifdef _WIN32
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(SolutionFileHeader)))
+    {
+        close();
+        return false;
+    }
+    length = static_cast<size_t>(fileSize.QuadPart);
+
+    mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle)
+    {
+        close();
+        return false;
+    }
+    data = static_cast<const uint8_t *>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(SolutionFileHeader)))
+    {
+        close();
+        return false;
+    }
+    length = static_cast<size_t>(info.st_size);
+
+    void *mapped = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    data = mapped == MAP_FAILED ? nullptr : static_cast<const uint8_t *>(mapped);
+#endif
+
+    if (!data)
+    {
+        close();
+        return false;
+    }
+
+    header = reinterpret_cast<const SolutionFileHeader *>(data);
+    if (std::memcmp(header->magic, SOLUTION_FILE_MAGIC, sizeof(header->magic)) != 0)
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void SolutionFileReader::close()
+{
+#ifdef _WIN32
+    if (data)
+        UnmapViewOfFile(data);
+    if (mappingHandle)
+        CloseHandle(mappingHandle);
+    if (fileHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (data)
+        munmap(const_cast<uint8_t *>(data), length);
+    if (fd != -1)
+        ::close(fd);
+    fd = -1;
+#endif
+
+    data = nullptr;
+    header = nullptr;
+    length = 0;
+}
+
+Solution SolutionFileReader::get(uint64_t index) const
+{
+    int n = boardSize();
+    const uint8_t *record = data + sizeof(SolutionFileHeader) + index * header->bytesPerSolution;
+    uint64_t mask = (1ULL << header->bitsPerRow) - 1;
+
+    Solution solution(n);
+    uint64_t pending = 0;
+    int pendingBits = 0;
+
+    for (int row = 0; row < n; row++)
+    {
+        while (pendingBits < static_cast<int>(header->bitsPerRow))
+        {
+            pending |= static_cast<uint64_t>(*record++) << pendingBits;
+            pendingBits += 8;
+        }
+
+        solution[row] = static_cast<int>(pending & mask);
+        pending >>= header->bitsPerRow;
+        pendingBits -= header->bitsPerRow;
+    }
+
+    return solution;
+}
+
+bool SolutionFileReader::verify() const
+{
+    if (length != sizeof(SolutionFileHeader) + size() * header->bytesPerSolution)
+        return false;
+
+    int n = boardSize();
+    std::vector<uint8_t> cols(n), diagDown(2 * n), diagUp(2 * n);
+
+    for (uint64_t i = 0; i < size(); i++)
+    {
+        Solution solution = get(i);
+
+        std::fill(cols.begin(), cols.end(), 0);
+        std::fill(diagDown.begin(), diagDown.end(), 0);
+        std::fill(diagUp.begin(), diagUp.end(), 0);
+
+        for (int row = 0; row < n; row++)
+        {
+            int col = solution[row];
+            if (col >= n || cols[col] || diagDown[row + col] || diagUp[row - col + n])
+                return false;
+            cols[col] = diagDown[row + col] = diagUp[row - col + n] = 1;
+        }
+    }
+
+    return true;
+}
+
+void SolutionFileReader::exportText(std::ostream &out) const
+{
+    int n = boardSize();
+    BoardPrinter printer(out, n);
+    SolutionBatch batch(&printer, n);
+
+    for (uint64_t i = 0; i < size(); i++)
+        batch.add(get(i));
+
+    batch.flush();
+    printer.close();
+}
@@ -0,0 +1,95 @@
+#ifndef SOLUTIONFILE_H
+#define SOLUTIONFILE_H
+
+#include "Solver.h"
+#include "SolutionSink.h"
+#include <string>
+#include <fstream>
+#include <ostream>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+// binary solution file: a 32 byte header, then count fixed width records, one per solution
+// a record packs row r's column into bits [r * bitsPerRow, (r + 1) * bitsPerRow), lowest bit first,
+// padded to whole bytes, so solution i starts at byte 32 + i * bytesPerSolution and the file can be mapped as is
+struct SolutionFileHeader
+{
+    char magic[8]; // "NQSOLS1"
+    uint32_t boardSize;
+    uint32_t bitsPerRow;
+    uint32_t bytesPerSolution;
+    uint32_t reserved;
+    uint64_t count;
+};
+
+static_assert(sizeof(SolutionFileHeader) == 32, "solution file header has to stay 32 bytes");
+
+// sink that appends every batch it gets to a solution file
+// batches are packed on the calling (solver) thread, only the write itself is under the lock
+// the count in the header is filled in by close()
+class SolutionFileWriter : public SolutionSink
+{
+private:
+    std::ofstream file;
+    SolutionFileHeader header;
+    bool mirrored; // also write every board flipped left to right (symmetry MIRROR only searches half)
+    std::mutex fileMutex;
+    bool closed;
+
+    void pack(const int *board, bool flip, uint8_t *record) const;
+
+public:
+    SolutionFileWriter(const std::string &path, int boardSize, bool mirrored = false);
+    ~SolutionFileWriter();
+
+    SolutionFileWriter(const SolutionFileWriter &) = delete;
+    SolutionFileWriter &operator=(const SolutionFileWriter &) = delete;
+
+    bool good() const { return file.good(); }
+    void consume(std::vector<int> &&cells) override;
+
+    // patch the final count into the header
+    void close();
+};
+
+// read only view of a solution file, mapped into memory instead of read
+class SolutionFileReader
+{
+private:
+    const uint8_t *data;
+    size_t length;
+    const SolutionFileHeader *header;
+
+#ifdef _WIN32
+    void *fileHandle;
+    void *mappingHandle;
+#else
+    int fd;
+#endif
+
+public:
+    SolutionFileReader();
+    ~SolutionFileReader();
+
+    SolutionFileReader(const SolutionFileReader &) = delete;
+    SolutionFileReader &operator=(const SolutionFileReader &) = delete;
+
+    // false if the file can't be mapped or isn't a solution file
+    bool open(const std::string &path);
+    void close();
+
+    int boardSize() const { return static_cast<int>(header->boardSize); }
+    uint64_t size() const { return header->count; }
+
+    // solution i, without touching any other record
+    Solution get(uint64_t index) const;
+
+    // checks the file is as long as the header says and every record is a valid placement of n queens
+    bool verify() const;
+
+    // the old text layout, "Solution k:" followed by the board
+    void exportText(std::ostream &out) const;
+};
+
+#endif
@@ -0,0 +1,171 @@
+#include "SolutionIndex.h"
+#include "BTBitsSolver.h"
+#include <algorithm>
+#include <cstdlib>
+#include <queue>
+#include <mutex>
+
+// solutions below a (prefix) board, the bitset solver already treats set rows as fixed
+template <typename Domain>
+static uint64_t countWith(int n, const Solution &prefix)
+{
+    BTBitsSolver<Domain> solver(n, prefix, 0, nullptr, nullptr, true);
+    solver.solve();
+    return solver.getSolutionCount();
+}
+
+// every prefix that survives depth rows, in lexicographic order (the seed generator's output)
+template <typename Domain>
+static std::vector<Solution> prefixesWith(int n, int depth)
+{
+    std::queue<Solution> queue;
+    std::mutex queueMutex;
+    BTBitsSolver<Domain> seeder(n, Solution(n, -1), depth, &queue, &queueMutex, true);
+    seeder.solve();
+
+    std::vector<Solution> prefixes;
+    prefixes.reserve(queue.size());
+    while (!queue.empty())
+    {
+        prefixes.push_back(std::move(queue.front()));
+        queue.pop();
+    }
+    return prefixes;
+}
+
+// same width selection as the runner, the narrowest bitset the board fits in
+#define DISPATCH_BITSET_WIDTH(FUNCTION, ...)              \
+    if (n <= 64)                                          \
+        return FUNCTION<Bitset<1>>(__VA_ARGS__);          \
+    if (n <= 128)                                         \
+        return FUNCTION<Bitset<2>>(__VA_ARGS__);          \
+    if (n <= 256)                                         \
+        return FUNCTION<Bitset<4>>(__VA_ARGS__);          \
+    if (n <= 512)                                         \
+        return FUNCTION<Bitset<8>>(__VA_ARGS__);          \
+    return FUNCTION<Bitset<16>>(__VA_ARGS__);
+
+uint64_t SolutionIndex::countCompletions(const Solution &prefix) const
+{
+    DISPATCH_BITSET_WIDTH(countWith, n, prefix)
+}
+
+static std::vector<Solution> survivingPrefixes(int n, int depth)
+{
+    DISPATCH_BITSET_WIDTH(prefixesWith, n, depth)
+}
+
+#undef DISPATCH_BITSET_WIDTH
+
+SolutionIndex::SolutionIndex(int boardSize, int cacheDepth)
+    : n(boardSize), cacheDepth(std::max(0, std::min(cacheDepth, boardSize)))
+{
+    nodes.push_back(RankNode{0, 0, 0, 0});
+    if (n == 0 || n > MAX_BITSET_BOARD)
+        return;
+
+    if (this->cacheDepth == 0)
+    {
+        nodes[0].count = countCompletions(Solution(n, -1));
+        return;
+    }
+
+    std::vector<Solution> prefixes = survivingPrefixes(n, this->cacheDepth);
+
+    // a prefix has as many solutions as its mirror image, and the mirror of anything starting in the right half
+    // comes earlier in the (sorted) list, so only about half of them need a search
+    std::vector<uint64_t> counts(prefixes.size());
+    for (size_t i = 0; i < prefixes.size(); i++)
+    {
+        Solution mirrored = prefixes[i];
+        for (int row = 0; row < this->cacheDepth; row++)
+            mirrored[row] = n - 1 - mirrored[row];
+
+        auto it = std::lower_bound(prefixes.begin(), prefixes.begin() + i, mirrored);
+        if (it != prefixes.begin() + i && *it == mirrored)
+            counts[i] = counts[it - prefixes.begin()];
+        else
+            counts[i] = countCompletions(prefixes[i]);
+    }
+
+    nodes[0].count = build(0, 0, prefixes, counts, 0, prefixes.size());
+}
+
+// fills in the children of node from prefixes[first .. last), which all share its depth rows
+// children are allocated as one block before recursing, so they stay contiguous
+uint64_t SolutionIndex::build(uint32_t node, int depth, const std::vector<Solution> &prefixes,
+                              const std::vector<uint64_t> &counts, size_t first, size_t last)
+{
+    if (depth == cacheDepth)
+        return counts[first];
+
+    std::vector<size_t> groupStart;
+    for (size_t i = first; i < last; i++)
+    {
+        if (i == first || prefixes[i][depth] != prefixes[i - 1][depth])
+            groupStart.push_back(i);
+    }
+    groupStart.push_back(last);
+
+    uint32_t firstChild = static_cast<uint32_t>(nodes.size());
+    uint16_t childCount = static_cast<uint16_t>(groupStart.size() - 1);
+    nodes[node].firstChild = firstChild;
+    nodes[node].childCount = childCount;
+    for (size_t g = 0; g < childCount; g++)
+        nodes.push_back(RankNode{0, 0, 0, static_cast<uint16_t>(prefixes[groupStart[g]][depth])});
+
+    uint64_t total = 0;
+    for (size_t g = 0; g < childCount; g++)
+    {
+        uint64_t count = build(firstChild + g, depth + 1, prefixes, counts, groupStart[g], groupStart[g + 1]);
+        nodes[firstChild + g].count = count;
+        total += count;
+    }
+    return total;
+}
+
+Solution SolutionIndex::unrank(uint64_t rank) const
+{
+    if (rank >= size())
+        return Solution();
+
+    Solution board(n, -1);
+
+    // cached rows, skip whole subtrees by their counts
+    uint32_t node = 0;
+    int depth = 0;
+    for (; depth < cacheDepth; depth++)
+    {
+        const RankNode &parent = nodes[node];
+        uint32_t child = parent.firstChild;
+        while (rank >= nodes[child].count)
+        {
+            rank -= nodes[child].count;
+            child++;
+        }
+
+        board[depth] = nodes[child].col;
+        node = child;
+    }
+
+    // below the cache, count each candidate's subtree until the one holding the rank
+    for (; depth < n; depth++)
+    {
+        for (int col = 0; col < n; col++)
+        {
+            bool attacked = false;
+            for (int row = 0; row < depth && !attacked; row++)
+                attacked = board[row] == col || depth - row == std::abs(board[row] - col);
+            if (attacked)
+                continue;
+
+            board[depth] = col;
+            uint64_t count = depth == n - 1 ? 1 : countCompletions(board);
+            if (rank < count)
+                break;
+            rank -= count;
+        }
+    }
+
+    return board;
+}
@@ -0,0 +1,56 @@
+#ifndef SOLUTIONINDEX_H
+#define SOLUTIONINDEX_H
+
+#include "Solver.h"
+#include <vector>
+#include <random>
+#include <cstdint>
+
+// random access to the solutions of a board by rank (their position in lexicographic order), without storing them
+// the number of solutions under every prefix down to cacheDepth rows is counted once up front (with the bitset
+// solver in count only mode), unrank() then walks those counts down to the cached depth and only counts the
+// subtrees along its own path below it, so a lookup costs about depth * branching small searches instead of
+// enumerating everything in front of the rank
+// deeper caches make lookups cheaper but grow (roughly n^cacheDepth prefixes)
+class SolutionIndex
+{
+private:
+    // one cached prefix, its children (one per column that isn't attacked) are nodes[firstChild .. + childCount)
+    struct RankNode
+    {
+        uint64_t count; // solutions below this prefix
+        uint32_t firstChild;
+        uint16_t childCount;
+        uint16_t col;
+    };
+
+    int n;
+    int cacheDepth;
+    std::vector<RankNode> nodes; // nodes[0] = the empty board
+
+    uint64_t build(uint32_t node, int depth, const std::vector<Solution> &prefixes,
+                   const std::vector<uint64_t> &counts, size_t first, size_t last);
+    uint64_t countCompletions(const Solution &prefix) const;
+
+public:
+    SolutionIndex(int boardSize, int cacheDepth = 3);
+
+    uint64_t size() const { return nodes[0].count; }
+    size_t cachedPrefixes() const { return nodes.size(); }
+
+    // rank-th solution in lexicographic order, empty if there aren't that many
+    Solution unrank(uint64_t rank) const;
+
+    // uniformly random solution, empty if there are none
+    template <typename Rng>
+    Solution sample(Rng &rng) const
+    {
+        if (size() == 0)
+            return Solution();
+
+        std::uniform_int_distribution<uint64_t> pick(0, size() - 1);
+        return unrank(pick(rng));
+    }
+};
+
+#endif
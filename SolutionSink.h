@@ -0,0 +1,79 @@
+#ifndef SOLUTIONSINK_H
+#define SOLUTIONSINK_H
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+// takes solutions while the search is still running, instead of them piling up in the solvers
+// cells holds whole boards back to back (n columns each), consume is called from every solver thread
+class SolutionSink
+{
+public:
+    virtual ~SolutionSink() = default;
+    virtual void consume(std::vector<int> &&cells) = 0;
+};
+
+// hands every batch to each of several sinks (e.g. printing and saving at the same time)
+class SinkFanout : public SolutionSink
+{
+private:
+    std::vector<SolutionSink *> sinks;
+
+public:
+    void add(SolutionSink *sink) { sinks.push_back(sink); }
+    bool empty() const { return sinks.empty(); }
+
+    void consume(std::vector<int> &&cells) override
+    {
+        for (size_t i = 0; i + 1 < sinks.size(); i++)
+            sinks[i]->consume(std::vector<int>(cells));
+        if (!sinks.empty())
+            sinks.back()->consume(std::move(cells));
+    }
+};
+
+// per thread buffer in front of a sink, the solvers add boards here and the sink only sees full batches
+// flushes whatever is left when it goes out of scope
+class SolutionBatch
+{
+private:
+    SolutionSink *sink;
+    int n;
+    size_t capacity; // in cells, batchSize boards
+    std::vector<int> cells;
+
+public:
+    SolutionBatch(SolutionSink *sink, int boardSize, size_t batchSize = 4096)
+        : sink(sink), n(boardSize), capacity(batchSize * boardSize)
+    {
+        cells.reserve(capacity);
+    }
+
+    ~SolutionBatch() { flush(); }
+
+    SolutionBatch(const SolutionBatch &) = delete;
+    SolutionBatch &operator=(const SolutionBatch &) = delete;
+
+    template <typename Board>
+    void add(const Board &board)
+    {
+        for (int row = 0; row < n; row++)
+            cells.push_back(board[row]);
+
+        if (cells.size() >= capacity)
+            flush();
+    }
+
+    void flush()
+    {
+        if (cells.empty())
+            return;
+
+        sink->consume(std::move(cells));
+        cells = std::vector<int>();
+        cells.reserve(capacity);
+    }
+};
+
+#endif
@@ -0,0 +1,286 @@
+#include "SolutionTrie.h"
+#include <algorithm>
+
+SolutionTrie::SolutionTrie(int boardSize)
+    : n(boardSize), boards(0), slots(1024, PENDING), registered(0), path(std::max(boardSize, 1)), openDepth(0),
+      root(EMPTY)
+{
+}
+
+uint32_t SolutionTrie::nodeEnd(uint32_t id) const
+{
+    while (!(edgeCol[id] & LAST_EDGE))
+        id++;
+    return id + 1;
+}
+
+size_t SolutionTrie::hashNode(uint32_t id) const
+{
+    uint64_t hash = 0x9E3779B97F4A7C15ull;
+    for (uint32_t e = id, end = nodeEnd(id); e < end; e++)
+    {
+        hash ^= (static_cast<uint64_t>(edgeChild[e]) << 16) | edgeCol[e];
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+
+    // slots are picked by the low bits, which the multiplies above barely touch
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    hash ^= hash >> 33;
+    return static_cast<size_t>(hash);
+}
+
+bool SolutionTrie::sameNode(uint32_t a, uint32_t b) const
+{
+    for (;; a++, b++)
+    {
+        if (edgeCol[a] != edgeCol[b] || edgeChild[a] != edgeChild[b])
+            return false;
+        if (edgeCol[a] & LAST_EDGE)
+            return true;
+    }
+}
+
+void SolutionTrie::growRegistry()
+{
+    std::vector<uint32_t> old(slots.size() * 2, PENDING);
+    old.swap(slots);
+
+    size_t mask = slots.size() - 1;
+    for (uint32_t id : old)
+    {
+        if (id == PENDING)
+            continue;
+
+        size_t slot = hashNode(id) & mask;
+        while (slots[slot] != PENDING)
+            slot = (slot + 1) & mask;
+        slots[slot] = id;
+    }
+}
+
+void SolutionTrie::rebuildRegistry()
+{
+    // every node in the pool is unique (the ones left behind by thaw included), so all of them go back in
+    size_t size = 1024;
+    while (registered * 4 > size * 3)
+        size *= 2;
+    slots.assign(size, PENDING);
+
+    size_t mask = slots.size() - 1;
+    for (uint32_t id = 0; id < edgeCol.size(); id = nodeEnd(id))
+    {
+        size_t slot = hashNode(id) & mask;
+        while (slots[slot] != PENDING)
+            slot = (slot + 1) & mask;
+        slots[slot] = id;
+    }
+}
+
+uint32_t SolutionTrie::intern(Edges &edges)
+{
+    if (edges.empty())
+        return EMPTY;
+
+    std::sort(edges.begin(), edges.end());
+
+    if (slots.empty())
+        rebuildRegistry();
+
+    // the pool only grows by a quarter at a time, doubling would leave up to half of it unused
+    size_t needed = edgeCol.size() + edges.size();
+    if (needed > edgeCol.capacity())
+    {
+        size_t capacity = std::max(needed, edgeCol.capacity() + edgeCol.capacity() / 4 + 1024);
+        edgeCol.reserve(capacity);
+        edgeChild.reserve(capacity);
+    }
+
+    // append it as a new node, and take it back off if the same node is already stored
+    uint32_t id = static_cast<uint32_t>(edgeCol.size());
+    for (const auto &edge : edges)
+    {
+        edgeCol.push_back(edge.first);
+        edgeChild.push_back(edge.second);
+    }
+    edgeCol.back() |= LAST_EDGE;
+
+    size_t mask = slots.size() - 1;
+    size_t slot = hashNode(id) & mask;
+    while (slots[slot] != PENDING)
+    {
+        if (sameNode(slots[slot], id))
+        {
+            edgeCol.resize(id);
+            edgeChild.resize(id);
+            return slots[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    slots[slot] = id;
+    if (++registered * 4 > slots.size() * 3)
+        growRegistry();
+    return id;
+}
+
+void SolutionTrie::thaw(uint32_t id, Edges &edges) const
+{
+    edges.clear();
+    if (id == EMPTY)
+        return;
+
+    for (uint32_t e = id, end = nodeEnd(id); e < end; e++)
+        edges.push_back({static_cast<uint16_t>(edgeCol[e] & ~LAST_EDGE), edgeChild[e]});
+}
+
+void SolutionTrie::freezeBelow(int depth)
+{
+    while (openDepth > depth + 1)
+    {
+        int level = openDepth - 1;
+        path[level - 1].back().second = intern(path[level]);
+        openDepth--;
+    }
+}
+
+void SolutionTrie::consume(std::vector<int> &&cells)
+{
+    if (n == 0)
+        return;
+
+    for (size_t i = 0; i + n <= cells.size(); i += n)
+        insert(cells.data() + i);
+}
+
+void SolutionTrie::finish()
+{
+    if (openDepth > 0)
+    {
+        freezeBelow(0);
+        root = intern(path[0]);
+        openDepth = 0;
+    }
+
+    // the registry is only needed while nodes are being added, it's rebuilt if that happens again
+    std::vector<uint32_t>().swap(slots);
+    for (auto &level : path)
+        Edges().swap(level);
+}
+
+// imported[id] = copy of other's node id in this pool, PENDING until it's been copied
+// the open path isn't used once finished, so path[depth] holds the edges being copied
+uint32_t SolutionTrie::importNode(const SolutionTrie &other, uint32_t id, int depth, std::vector<uint32_t> &imported)
+{
+    if (id == TERMINAL || id == EMPTY)
+        return id;
+    if (imported[id] != PENDING)
+        return imported[id];
+
+    Edges &edges = path[depth];
+    edges.clear();
+    for (uint32_t e = id, end = other.nodeEnd(id); e < end; e++)
+    {
+        uint16_t col = other.edgeCol[e] & ~LAST_EDGE;
+        edges.push_back({col, importNode(other, other.edgeChild[e], depth + 1, imported)});
+    }
+
+    imported[id] = intern(edges);
+    return imported[id];
+}
+
+// shared gets the number of boards that were under both a and b
+uint32_t SolutionTrie::unite(uint32_t a, uint32_t b, uint64_t &shared,
+                             std::unordered_map<uint64_t, std::pair<uint32_t, uint64_t>> &memo)
+{
+    if (a == b)
+    {
+        std::unordered_map<uint32_t, uint64_t> counts;
+        shared += countBelow(a, counts);
+        return a;
+    }
+    if (b == EMPTY)
+        return a;
+    if (a == EMPTY)
+        return b;
+
+    uint64_t key = (static_cast<uint64_t>(a) << 32) | b;
+    auto it = memo.find(key);
+    if (it != memo.end())
+    {
+        shared += it->second.second;
+        return it->second.first;
+    }
+
+    // both edge lists are sorted, walk them side by side and unite the children under a shared column
+    // (edges are copied out first, interning can move the pool around)
+    Edges edgesA, edgesB, edges;
+    thaw(a, edgesA);
+    thaw(b, edgesB);
+
+    uint64_t below = 0;
+    size_t i = 0, j = 0;
+    while (i < edgesA.size() || j < edgesB.size())
+    {
+        if (j == edgesB.size() || (i < edgesA.size() && edgesA[i].first < edgesB[j].first))
+            edges.push_back(edgesA[i++]);
+        else if (i == edgesA.size() || edgesB[j].first < edgesA[i].first)
+            edges.push_back(edgesB[j++]);
+        else
+        {
+            edges.push_back({edgesA[i].first, unite(edgesA[i].second, edgesB[j].second, below, memo)});
+            i++;
+            j++;
+        }
+    }
+
+    uint32_t united = intern(edges);
+    memo[key] = {united, below};
+    shared += below;
+    return united;
+}
+
+uint64_t SolutionTrie::countBelow(uint32_t id, std::unordered_map<uint32_t, uint64_t> &memo) const
+{
+    if (id == TERMINAL)
+        return 1;
+    if (id == EMPTY)
+        return 0;
+
+    auto it = memo.find(id);
+    if (it != memo.end())
+        return it->second;
+
+    uint64_t count = 0;
+    for (uint32_t e = id, end = nodeEnd(id); e < end; e++)
+        count += countBelow(edgeChild[e], memo);
+
+    memo[id] = count;
+    return count;
+}
+
+void SolutionTrie::merge(const SolutionTrie &other)
+{
+    if (&other == this || other.n != n || other.root == EMPTY)
+        return;
+
+    std::vector<uint32_t> imported(other.edgeCol.size(), PENDING);
+    uint32_t otherRoot = importNode(other, other.root, 0, imported);
+    std::vector<uint32_t>().swap(imported);
+
+    // boards both stores had only count once
+    uint64_t shared = 0;
+    std::unordered_map<uint64_t, std::pair<uint32_t, uint64_t>> memo;
+    root = unite(root, otherRoot, shared, memo);
+    boards += other.boards - shared;
+}
+
+size_t SolutionTrie::memoryBytes() const
+{
+    size_t bytes = edgeCol.capacity() * sizeof(uint16_t) + edgeChild.capacity() * sizeof(uint32_t) +
+                   slots.capacity() * sizeof(uint32_t);
+    for (const auto &level : path)
+        bytes += level.capacity() * sizeof(level[0]);
+    return bytes;
+}
@@ -0,0 +1,179 @@
+#ifndef SOLUTIONTRIE_H
+#define SOLUTIONTRIE_H
+
+#include "Solver.h"
+#include "SolutionSink.h"
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+// compressed in memory store for solutions, as a prefix trie where identical subtrees are only stored once (a DAG)
+// a node is just its run of edges (column, child) in edgeCol / edgeChild, sorted by column, with LAST_EDGE set on
+// the column of the final one, and its id is where that run starts, so a node costs nothing on top of its edges
+// every node is unique, so a board costs a few shared edges instead of its own heap allocated vector
+//
+// boards are inserted along an open path that is only frozen (deduplicated) once the search has moved past it,
+// so boards that come in DFS order, like they do from the solvers, never touch a frozen node again
+// boards in any other order still work, the frozen nodes they run into are copied back onto the open path
+// (the old copies just stay in the pool)
+class SolutionTrie : public SolutionSink
+{
+private:
+    using Edges = std::vector<std::pair<uint16_t, uint32_t>>;
+
+    static constexpr uint32_t PENDING = UINT32_MAX;      // child of the open edge, not frozen yet
+    static constexpr uint32_t TERMINAL = UINT32_MAX - 1; // end of a board, shared by every solution
+    static constexpr uint32_t EMPTY = UINT32_MAX - 2;    // root of a store without any boards
+    static constexpr uint16_t LAST_EDGE = 0x8000;
+
+    int n;
+    uint64_t boards;
+
+    // frozen nodes
+    std::vector<uint16_t> edgeCol;
+    std::vector<uint32_t> edgeChild;
+
+    // open addressing set of node ids, hashed by their edges, so every node is only stored once
+    std::vector<uint32_t> slots; // PENDING = empty slot, dropped by finish()
+    size_t registered;
+
+    // open path, path[depth] = edges of the open node at that depth, its last edge leads to path[depth + 1]
+    std::vector<Edges> path;
+    int openDepth; // path[0 .. openDepth - 1] are open, 0 once everything is frozen
+    uint32_t root;
+
+    uint32_t nodeEnd(uint32_t id) const;
+    size_t hashNode(uint32_t id) const;
+    bool sameNode(uint32_t a, uint32_t b) const;
+    void growRegistry();
+    void rebuildRegistry();
+    uint32_t intern(Edges &edges);
+    void thaw(uint32_t id, Edges &edges) const;
+    void freezeBelow(int depth);
+    uint32_t importNode(const SolutionTrie &other, uint32_t id, int depth, std::vector<uint32_t> &imported);
+    uint32_t unite(uint32_t a, uint32_t b, uint64_t &shared,
+                   std::unordered_map<uint64_t, std::pair<uint32_t, uint64_t>> &memo);
+    uint64_t countBelow(uint32_t id, std::unordered_map<uint32_t, uint64_t> &memo) const;
+
+public:
+    explicit SolutionTrie(int boardSize);
+
+    SolutionTrie(const SolutionTrie &) = delete;
+    SolutionTrie &operator=(const SolutionTrie &) = delete;
+
+    // adds a board, adding one that is already stored does nothing
+    template <typename Board>
+    void insert(const Board &board);
+
+    void consume(std::vector<int> &&cells) override;
+
+    // freezes the open path and frees everything only needed for adding boards,
+    // has to be called before forEach() or merge()
+    void finish();
+
+    // adds every board of other, both have to be finished
+    // keeps what it needs for adding boards around for the next merge, call finish() again after the last one
+    void merge(const SolutionTrie &other);
+
+    uint64_t size() const { return boards; }
+    size_t edgeCount() const { return edgeCol.size(); }
+    size_t memoryBytes() const;
+
+    // calls visit(board) for every board, in lexicographic order
+    template <typename Visit>
+    void forEach(Visit visit) const;
+};
+
+template <typename Board>
+void SolutionTrie::insert(const Board &board)
+{
+    if (n == 0)
+        return;
+
+    // reopen the root if everything was frozen
+    if (openDepth == 0)
+    {
+        thaw(root, path[0]);
+        openDepth = 1;
+    }
+
+    // follow the open path as far as the board agrees with it, everything past that is done
+    int depth = 0;
+    while (depth + 1 < openDepth && path[depth].back().first == board[depth])
+        depth++;
+    freezeBelow(depth);
+
+    for (; depth < n; depth++)
+    {
+        Edges &edges = path[depth];
+        uint16_t col = static_cast<uint16_t>(board[depth]);
+
+        size_t found = 0;
+        while (found < edges.size() && edges[found].first != col)
+            found++;
+
+        if (depth == n - 1)
+        {
+            if (found == edges.size())
+            {
+                edges.push_back({col, TERMINAL});
+                boards++;
+            }
+            return;
+        }
+
+        // a column we've been down before, its frozen subtree becomes the next open node
+        if (found < edges.size())
+        {
+            uint32_t child = edges[found].second;
+            edges.erase(edges.begin() + found);
+            thaw(child, path[depth + 1]);
+        }
+        else
+        {
+            path[depth + 1].clear();
+        }
+
+        edges.push_back({col, PENDING});
+        openDepth = depth + 2;
+    }
+}
+
+template <typename Visit>
+void SolutionTrie::forEach(Visit visit) const
+{
+    if (n == 0 || root == EMPTY)
+        return;
+
+    Solution board(n);
+    std::vector<uint32_t> edge(n); // edge[depth] = edge being walked at that depth
+
+    int depth = 0;
+    edge[0] = root;
+    while (true)
+    {
+        board[depth] = edgeCol[edge[depth]] & ~LAST_EDGE;
+
+        if (depth < n - 1)
+        {
+            edge[depth + 1] = edgeChild[edge[depth]];
+            depth++;
+            continue;
+        }
+
+        visit(static_cast<const Solution &>(board));
+
+        // next sibling, going back up past every node we're done with
+        while (edgeCol[edge[depth]] & LAST_EDGE)
+        {
+            if (depth == 0)
+                return;
+            depth--;
+        }
+        edge[depth]++;
+    }
+}
+
+#endif
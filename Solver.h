@@ -1,19 +1,35 @@
-#ifndef SOLVER_H
-#define SOLVER_H
-
-#include <vector>
-#include <chrono>
-
-// TODO: update all solvers to use solution instead of vector int
-using Solution = std::vector<int>;
-
-class Solver
-{
-public:
-    virtual ~Solver() = default;
-    virtual void solve() = 0;
-    virtual const std::vector<Solution> &getSolutions() const = 0;
-    virtual std::chrono::high_resolution_clock::time_point getFirstSolutionTime() const = 0;
-};
-
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include "SearchStats.h"
+
+// TODO: update all solvers to use solution instead of vector int
+using Solution = std::vector<int>;
+
+class Solver
+{
+public:
+    virtual ~Solver() = default;
+    virtual void solve() = 0;
+
+    // start over from another initial state, so one solver can run seed after seed
+    // drops the solutions, counts and first solution time, but keeps whatever it allocated
+    virtual void reset(const Solution &initialState) = 0;
+
+    virtual const std::vector<Solution> &getSolutions() const = 0;
+
+    // hands the solutions over instead of copying them, the solver is left with none (reset() would drop them anyway)
+    virtual std::vector<Solution> takeSolutions() = 0;
+    virtual std::chrono::high_resolution_clock::time_point getFirstSolutionTime() const = 0;
+
+    // every solution found, also the ones getSolutions() left out in count only mode
+    virtual uint64_t getSolutionCount() const = 0;
+
+    // search effort since the last reset, only revise calls unless built with NQUEENS_SEARCH_STATS
+    virtual const SearchStats &getStats() const = 0;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "Symmetry.h"
+#include <algorithm>
+
+std::vector<Solution> mirrorRoots(int boardSize)
+{
+    std::vector<Solution> roots;
+
+    if (boardSize < 2)
+    {
+        roots.push_back(Solution(boardSize, -1));
+        return roots;
+    }
+
+    int half = boardSize / 2;
+
+    for (int col = 0; col < half; col++)
+    {
+        Solution root(boardSize, -1);
+        root[0] = col;
+        roots.push_back(root);
+    }
+
+    // the middle column is its own mirror image, so split on the second row instead
+    // the second queen can't sit in or next to the middle column, so that's every column up to half - 2
+    if (boardSize % 2 == 1)
+    {
+        for (int col = 0; col < half - 1; col++)
+        {
+            Solution root(boardSize, -1);
+            root[0] = half;
+            root[1] = col;
+            roots.push_back(root);
+        }
+    }
+
+    return roots;
+}
+
+Solution mirrorSolution(const Solution &solution)
+{
+    int n = static_cast<int>(solution.size());
+    Solution mirrored(n);
+    for (int row = 0; row < n; row++)
+        mirrored[row] = n - 1 - solution[row];
+    return mirrored;
+}
+
+// the 8 rotations / reflections, each one moves the queen at (row, col) somewhere else
+static std::vector<Solution> symmetries(const Solution &solution)
+{
+    int n = static_cast<int>(solution.size());
+    std::vector<Solution> boards(8, Solution(n));
+
+    for (int row = 0; row < n; row++)
+    {
+        int col = solution[row];
+        int flippedRow = n - 1 - row;
+        int flippedCol = n - 1 - col;
+
+        boards[0][row] = col;
+        boards[1][row] = flippedCol;
+        boards[2][flippedRow] = col;
+        boards[3][flippedRow] = flippedCol;
+        boards[4][col] = row;
+        boards[5][col] = flippedRow;
+        boards[6][flippedCol] = row;
+        boards[7][flippedCol] = flippedRow;
+    }
+
+    return boards;
+}
+
+bool isCanonical(const Solution &solution)
+{
+    for (const Solution &board : symmetries(solution))
+    {
+        if (board < solution)
+            return false;
+    }
+    return true;
+}
+
+int orbitSize(const Solution &solution)
+{
+    std::vector<Solution> boards = symmetries(solution);
+    std::sort(boards.begin(), boards.end());
+    return static_cast<int>(std::unique(boards.begin(), boards.end()) - boards.begin());
+}
@@ -0,0 +1,23 @@
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include "Solver.h"
+#include <vector>
+
+// every solution's left-right mirror image is another solution, so it's enough to search the boards whose first
+// queen sits in the left half, plus the middle column on odd boards with the second queen in the left half
+// returns those partial boards (one or two rows set), the solutions under them are exactly half of all solutions
+// boards smaller than 2 have nothing to mirror and just get the empty board back
+std::vector<Solution> mirrorRoots(int boardSize);
+
+// solution flipped left to right
+Solution mirrorSolution(const Solution &solution);
+
+// true if solution is the lexicographically smallest of its 8 rotations / reflections
+// the smallest one always has its first queen in the left half, so it is always under one of the mirrorRoots
+bool isCanonical(const Solution &solution);
+
+// number of distinct boards among solution's 8 rotations / reflections (1, 2, 4 or 8)
+int orbitSize(const Solution &solution);
+
+#endif
@@ -0,0 +1,77 @@
+#include "Trace.h"
+#include <fstream>
+#include <iomanip>
+
+// TraceClock ticks since origin -> microseconds, which is what chrome traces count in
+static double toMicroseconds(int64_t ticks, int64_t origin)
+{
+    return static_cast<double>(ticks - origin) * TraceClock::period::num * 1e6 / TraceClock::period::den;
+}
+
+// "3 0 4 - 1": columns down to the last queen, - for rows that aren't set (dvo seeds)
+static std::string describeSeed(const PackedSeed &seed, Solution &board)
+{
+    seed.unpack(board);
+
+    size_t rows = board.size();
+    while (rows > 0 && board[rows - 1] == -1)
+        rows--;
+
+    std::string text;
+    for (size_t row = 0; row < rows; row++)
+    {
+        if (row > 0)
+            text += ' ';
+        text += board[row] == -1 ? "-" : std::to_string(board[row]);
+    }
+    return text;
+}
+
+bool writeChromeTrace(const std::string &path, const std::vector<const TraceBuffer *> &buffers, int64_t origin)
+{
+    std::ofstream file(path);
+    if (!file)
+        return false;
+
+    // microseconds with nanosecond digits, never in exponent notation
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    auto separate = [&]() {
+        file << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    Solution board;
+    for (size_t tid = 0; tid < buffers.size(); tid++)
+    {
+        const TraceBuffer &buffer = *buffers[tid];
+
+        // if the ring wrapped, say so on the thread itself so the missing start isn't mistaken for idle time
+        std::string name = buffer.name();
+        if (buffer.dropped() > 0)
+            name += " (" + std::to_string(buffer.dropped()) + " oldest spans dropped)";
+
+        separate();
+        file << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":" << tid
+             << ",\"args\":{\"name\":\"" << name << "\"}}";
+        separate();
+        file << "{\"ph\":\"M\",\"name\":\"thread_sort_index\",\"pid\":0,\"tid\":" << tid
+             << ",\"args\":{\"sort_index\":" << tid << "}}";
+
+        buffer.forEach([&](const TraceSpan &span) {
+            separate();
+            file << "{\"ph\":\"X\",\"name\":\"" << span.name << "\",\"pid\":0,\"tid\":" << tid
+                 << ",\"ts\":" << toMicroseconds(span.start, origin)
+                 << ",\"dur\":" << toMicroseconds(span.end, span.start)
+                 << ",\"args\":{\"count\":" << span.count;
+            if (span.seed.depth() > 0)
+                file << ",\"seed\":\"" << describeSeed(span.seed, board) << "\"";
+            file << "}}";
+        });
+    }
+
+    file << "\n]}\n";
+    return file.good();
+}
@@ -0,0 +1,73 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "Solver.h"
+#include "PackedSeed.h"
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+// timeline of a run: what every thread did when, written out as a chrome trace (chrome://tracing, ui.perfetto.dev)
+// steady_clock is monotonic and cheap to read (a vdso call on linux, QueryPerformanceCounter on windows), spans keep
+// its raw ticks and are only turned into microseconds when the file is written
+using TraceClock = std::chrono::steady_clock;
+
+// one finished span on a thread's timeline
+struct TraceSpan
+{
+    const char *name;   // always a string literal: "expand", "solve", "wait", "merge"...
+    int64_t start;      // TraceClock ticks
+    int64_t end;
+    uint64_t count;     // solutions for solve spans, seeds made for expand spans
+    PackedSeed seed;    // the seed the span worked on, empty if it didn't have one
+};
+
+// spans of one thread, only ever written by that thread
+// a ring: once it's full the oldest spans are overwritten, so a long run keeps its last CAPACITY spans and the
+// memory stays fixed (slots are allocated up front, a seed only allocates if it's deeper than PackedSeed keeps inline)
+class TraceBuffer
+{
+private:
+    std::string threadName;
+    std::vector<TraceSpan> spans;
+    uint64_t recorded;
+
+public:
+    static constexpr size_t CAPACITY = 1 << 14;
+
+    explicit TraceBuffer(const std::string &threadName) : threadName(threadName), spans(CAPACITY), recorded(0) {}
+
+    static int64_t now() { return TraceClock::now().time_since_epoch().count(); }
+
+    void record(const char *name, int64_t start, int64_t end, uint64_t count = 0, const Solution *seed = nullptr)
+    {
+        TraceSpan &span = spans[recorded % CAPACITY];
+        span.name = name;
+        span.start = start;
+        span.end = end;
+        span.count = count;
+        span.seed = seed ? PackedSeed(*seed) : PackedSeed();
+        recorded++;
+    }
+
+    const std::string &name() const { return threadName; }
+
+    // spans that were overwritten
+    uint64_t dropped() const { return recorded > CAPACITY ? recorded - CAPACITY : 0; }
+
+    // calls visit with every span still in the ring, oldest first
+    template <typename Visit>
+    void forEach(Visit visit) const
+    {
+        for (uint64_t i = dropped(); i < recorded; i++)
+            visit(spans[i % CAPACITY]);
+    }
+};
+
+// writes every buffer's spans as complete ("X") events, one chrome thread per buffer, timestamps relative to origin
+// false if the file couldn't be written
+bool writeChromeTrace(const std::string &path, const std::vector<const TraceBuffer *> &buffers, int64_t origin);
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef TRAIL_H
+#define TRAIL_H
+
+#include <vector>
+#include <cstddef>
+
+// one domain change, enough to undo it
+template <typename Domain>
+struct TrailEntry
+{
+    int row;
+    Domain domain; // domain of row before it got pruned
+};
+
+// one level of an in place search
+template <typename Domain>
+struct TrailFrame
+{
+    int row;          // row being assigned on this level
+    Domain remaining; // values of row not tried yet
+    size_t trailMark; // trail size before any value of this level was tried
+};
+
+// log of every pruning since the root, so backtracking is just replaying it backwards
+// the vector only grows to the deepest path once, after that pushing is allocation free
+template <typename Domain>
+class Trail
+{
+private:
+    std::vector<TrailEntry<Domain>> entries;
+
+public:
+    size_t mark() const { return entries.size(); }
+
+    // a search that stopped early leaves its path on the trail
+    void clear() { entries.clear(); }
+
+    // call before changing domains[row]
+    void save(int row, const Domain &domain) { entries.push_back(TrailEntry<Domain>{row, domain}); }
+
+    // restore every domain changed since mark
+    template <typename Domains>
+    void undo(Domains &domains, size_t mark)
+    {
+        while (entries.size() > mark)
+        {
+            const TrailEntry<Domain> &entry = entries.back();
+            domains[entry.row] = entry.domain;
+            entries.pop_back();
+        }
+    }
+};
+
+#endif
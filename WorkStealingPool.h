@@ -0,0 +1,235 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include "Solver.h"
+#include "PackedSeed.h"
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// work for the parallel runner: one deque of seeds (partial boards) per worker instead of a single shared queue
+// a worker takes the newest seed of its own deque, and once that runs dry steals the oldest seed of the fullest
+// other worker, the oldest seeds are the ones closest to the root, so they're also the biggest subtrees
+// every deque has its own lock, workers only ever meet on one when stealing
+// seeds can be pushed while the search runs, the pool is only done once every seed it handed out is done too
+// seeds are kept packed (see PackedSeed.h) and only unpacked into the taker's board
+// a deque holds at most capacity seeds from tryPush(), a producer that hits that searches the seed itself instead,
+// donations can't pile up either, a solver only splits while its own deque is empty (see starving())
+// the roots from distribute() are the one thing not capped, there are only ever a few per worker
+class WorkStealingPool
+{
+private:
+    // padded out to its own cache line, so workers hammering their own deque don't slow each other down
+    struct alignas(64) WorkerDeque
+    {
+        std::mutex lock;
+        std::deque<PackedSeed> seeds;
+        std::atomic<size_t> size{0}; // seeds.size(), readable without the lock to pick a victim
+    };
+
+    std::vector<WorkerDeque> deques;
+    size_t capacity;                  // seeds tryPush() leaves on one deque
+    std::atomic<int64_t> outstanding; // seeds queued or being solved
+    std::atomic<int> idleWorkers;     // workers waiting in next() for something to steal
+    std::atomic<bool> cancelled;
+    std::atomic<uint64_t> donated;    // seeds split off running solvers
+
+    // idle workers sleep here until a push (or the end of the search) wakes them
+    std::mutex idleLock;
+    std::condition_variable wake;
+
+    bool popOwn(int worker, Solution &seed)
+    {
+        WorkerDeque &own = deques[worker];
+        if (own.size.load(std::memory_order_relaxed) == 0)
+            return false;
+
+        std::lock_guard<std::mutex> lock(own.lock);
+        if (own.seeds.empty())
+            return false;
+
+        own.seeds.back().unpack(seed);
+        own.seeds.pop_back();
+        own.size.store(own.seeds.size(), std::memory_order_relaxed);
+        return true;
+    }
+
+    bool steal(int worker, Solution &seed)
+    {
+        // fullest victim first, the sizes can be stale so fall back to the others if it's empty by now
+        while (true)
+        {
+            int victim = -1;
+            size_t most = 0;
+            for (int other = 0; other < static_cast<int>(deques.size()); other++)
+            {
+                size_t size = deques[other].size.load(std::memory_order_relaxed);
+                if (other != worker && size > most)
+                {
+                    victim = other;
+                    most = size;
+                }
+            }
+            if (victim == -1)
+                return false;
+
+            WorkerDeque &target = deques[victim];
+            std::lock_guard<std::mutex> lock(target.lock);
+            if (target.seeds.empty())
+                continue;
+
+            target.seeds.front().unpack(seed);
+            target.seeds.pop_front();
+            target.size.store(target.seeds.size(), std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+public:
+    // 64k seeds of up to 40 bytes each, a few MB per worker
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 16;
+
+    explicit WorkStealingPool(int workers, size_t capacity = DEFAULT_CAPACITY)
+        : deques(workers > 0 ? workers : 1), capacity(capacity > 0 ? capacity : 1), outstanding(0), idleWorkers(0),
+          cancelled(false), donated(0) {}
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    int workers() const { return static_cast<int>(deques.size()); }
+
+    // the newest seed of a deque is the next one its worker takes
+    void push(int worker, const Solution &seed)
+    {
+        PackedSeed packed(seed);
+        outstanding.fetch_add(1);
+        {
+            WorkerDeque &own = deques[worker];
+            std::lock_guard<std::mutex> lock(own.lock);
+            own.seeds.push_back(std::move(packed));
+            own.size.store(own.seeds.size(), std::memory_order_relaxed);
+        }
+
+        if (idleWorkers.load() > 0)
+            wake.notify_one();
+    }
+
+    // push, unless worker's deque is full, false means the seed wasn't queued and the caller has to search it
+    // (only the worker itself pushes to its deque, the others only take from it, so the unlocked size can't overshoot)
+    bool tryPush(int worker, const Solution &seed)
+    {
+        if (deques[worker].size.load(std::memory_order_relaxed) >= capacity)
+            return false;
+        push(worker, seed);
+        return true;
+    }
+
+    // hands seeds out in contiguous blocks, each worker's block is queued so it's taken front to back
+    // (neighbouring seeds share prefixes, so a worker mostly walks one region of the tree in DFS order)
+    void distribute(const std::vector<Solution> &seeds)
+    {
+        size_t count = seeds.size();
+        size_t nWorkers = deques.size();
+        for (size_t worker = 0; worker < nWorkers; worker++)
+        {
+            size_t first = count * worker / nWorkers;
+            size_t last = count * (worker + 1) / nWorkers;
+            for (size_t i = last; i > first; i--)
+                push(static_cast<int>(worker), seeds[i - 1]);
+        }
+    }
+
+    // next seed for worker, stealing if its own deque is empty and waiting while other workers might still push
+    // false once everything is done (or cancelled)
+    bool next(int worker, Solution &seed)
+    {
+        if (popOwn(worker, seed) || steal(worker, seed))
+            return true;
+
+        idleWorkers.fetch_add(1);
+        bool found = false;
+        while (!cancelled.load() && outstanding.load() > 0)
+        {
+            if (popOwn(worker, seed) || steal(worker, seed))
+            {
+                found = true;
+                break;
+            }
+
+            // the timeout only covers a push racing past the check above
+            std::unique_lock<std::mutex> lock(idleLock);
+            wake.wait_for(lock, std::chrono::milliseconds(1));
+        }
+        idleWorkers.fetch_sub(1);
+        return found;
+    }
+
+    // a seed handed out by next() is fully searched
+    void done()
+    {
+        if (outstanding.fetch_sub(1) == 1)
+            wake.notify_all();
+    }
+
+    // stop handing out seeds, e.g. once the first k solutions are in
+    void cancel()
+    {
+        cancelled.store(true);
+        wake.notify_all();
+    }
+
+    // some worker is out of work, busy ones can split theirs up
+    bool hungry() const { return idleWorkers.load(std::memory_order_relaxed) > 0; }
+
+    // hungry, and nothing left on this worker's deque for the idle ones to steal, so only a split helps
+    bool starving(int worker) const
+    {
+        return hungry() && deques[worker].size.load(std::memory_order_relaxed) == 0;
+    }
+
+    // a subtree split off worker's running solver, queued like any other seed
+    void donate(int worker, const Solution &seed)
+    {
+        donated.fetch_add(1, std::memory_order_relaxed);
+        push(worker, seed);
+    }
+
+    uint64_t donations() const { return donated.load(); }
+
+    size_t queued() const
+    {
+        size_t total = 0;
+        for (const WorkerDeque &deque : deques)
+            total += deque.size.load(std::memory_order_relaxed);
+        return total;
+    }
+};
+
+// dynamic splitting: what a running solver sees of the pool
+// solvers ask wanted() once per node, while it's true they hand their oldest pending frames (closest to the root,
+// so the biggest subtrees) back as seeds, so a run can start from a few seeds and still keep every worker busy
+class WorkSplitter
+{
+private:
+    WorkStealingPool *pool;
+    int worker;
+
+public:
+    // subtrees with fewer unassigned rows than this are cheaper to search than to hand over
+    static constexpr int MIN_ROWS_LEFT = 4;
+
+    WorkSplitter(WorkStealingPool *pool, int worker) : pool(pool), worker(worker) {}
+
+    bool wanted() const { return pool->starving(worker); }
+
+    bool worthSplitting(int rowsLeft) const { return rowsLeft >= MIN_ROWS_LEFT; }
+
+    void donate(const Solution &seed) { pool->donate(worker, seed); }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#include "SolutionIndex.h"
+
+#include <iostream>
+#include <chrono>
+#include <random>
+
+// draws uniform random solutions by rank instead of enumerating and storing every one of them
+int main()
+{
+    const int samples = 1000;
+    const int cacheDepth = 3;
+    const unsigned seed = 12345;
+
+    const int boardSizes[] = {8, 10, 12, 14, 16};
+
+    std::mt19937_64 rng(seed);
+
+    for (const auto &size : boardSizes)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        SolutionIndex index(size, cacheDepth);
+        auto built = std::chrono::high_resolution_clock::now();
+
+        Solution sample;
+        for (int i = 0; i < samples; i++)
+            sample = index.sample(rng);
+        auto sampled = std::chrono::high_resolution_clock::now();
+
+        std::cout << "N = " << size << "\n";
+        std::cout << "- Solutions: " << index.size() << "\n";
+        std::cout << "- Cached Prefixes: " << index.cachedPrefixes() << " (depth " << cacheDepth << ")\n";
+        std::cout << "- Index Build Time: " << std::chrono::duration<double>(built - start).count() << " seconds\n";
+        std::cout << "- Time per Sample: " << std::chrono::duration<double>(sampled - built).count() / samples << " seconds\n";
+
+        std::cout << "- Last Sample:";
+        for (int col : sample)
+            std::cout << " " << col;
+        std::cout << "\n";
+
+        std::cout << "------------------------------------------------\n";
+    }
+
+    return 0;
+}
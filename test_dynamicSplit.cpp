@@ -0,0 +1,100 @@
+#include "ExperimentRunner.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// every solver type (and both AC3 propagation modes) has to hand work to idle workers when dynamicSplit is on
+// more workers than seeds, so some of them are idle from the start and a split can't just not be needed
+// returns 0 if every solver split at least once and still found every solution, seeding deeper than the board
+// counted right, and the pool kept to its cap
+int main()
+{
+    const int boardSize = 12;
+    const uint64_t solutions = 14200;
+
+    struct Variant
+    {
+        std::string solverType;
+        bool ac3Trail;
+    };
+    const Variant variants[] = {
+        {"BT", false},
+        {"BT-BITS", false},
+        {"BT-FC", false},
+        {"BT-FC-DVO", false},
+        {"AC3", false},
+        {"AC3", true},
+        {"AC3-DVO", false},
+        {"AC3-DVO", true},
+    };
+
+    int failures = 0;
+    for (const auto &variant : variants)
+    {
+        Config config{};
+        config.solverType = variant.solverType;
+        config.ac3Trail = variant.ac3Trail;
+        config.boardSize = boardSize;
+        config.nThreads = 2 * boardSize;
+        config.isParallel = true;
+        config.domainGranularity = 1;
+        config.dynamicSplit = true;
+        config.countOnly = true;
+
+        // the runner's own output would bury the results
+        std::ostringstream discarded;
+        std::streambuf *original = std::cout.rdbuf(discarded.rdbuf());
+        ExperimentResult result = runExperiment(config);
+        std::cout.rdbuf(original);
+
+        std::string name = variant.solverType + (variant.ac3Trail ? " (trail)" : "");
+        bool ok = result.splits > 0 && result.numberOfSolutions == solutions;
+        std::cout << (ok ? "ok     " : "FAILED ") << name << ": " << result.splits << " splits, "
+                  << result.numberOfSolutions << " solutions\n";
+        if (!ok)
+            failures++;
+    }
+
+    // seeding deeper than the board still leaves every seed a row to search, whatever the solver
+    const uint64_t small[] = {1, 0, 0, 2, 10, 4, 40};
+    for (const auto &variant : variants)
+    {
+        for (int n = 4; n <= 6; n++)
+        {
+            Config config{};
+            config.solverType = variant.solverType;
+            config.ac3Trail = variant.ac3Trail;
+            config.boardSize = n;
+            config.nThreads = 3;
+            config.isParallel = true;
+            config.domainGranularity = 20;
+
+            std::ostringstream discarded;
+            std::streambuf *original = std::cout.rdbuf(discarded.rdbuf());
+            ExperimentResult result = runExperiment(config);
+            std::cout.rdbuf(original);
+
+            if (result.numberOfSolutions != small[n - 1])
+            {
+                std::cout << "FAILED " << variant.solverType << (variant.ac3Trail ? " (trail)" : "") << " N = " << n
+                          << ", granularity 20: " << result.numberOfSolutions << " solutions\n";
+                failures++;
+            }
+        }
+    }
+
+    // a full deque turns seeds away, the producer searches those itself
+    WorkStealingPool pool(2, 3);
+    Solution seed(boardSize, -1);
+    int queued = 0;
+    for (int i = 0; i < 5; i++)
+        queued += pool.tryPush(0, seed) ? 1 : 0;
+    bool capped = queued == 3 && pool.queued() == 3 && pool.tryPush(1, seed);
+    std::cout << (capped ? "ok     " : "FAILED ") << "deque cap: " << queued << " of 5 seeds queued\n";
+    if (!capped)
+        failures++;
+
+    std::cout << (failures == 0 ? "dynamic split OK\n" : "dynamic split FAILED\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,62 @@
+#include "ExperimentRunner.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// first-k mode has to report exactly k solutions in every symmetry mode, whenever there are at least k of them
+// FUNDAMENTAL is the one to watch, its first boards found are often not canonical and used to leave nothing behind
+// returns 0 if every solver, sequential and parallel, found k
+int main()
+{
+    struct Case
+    {
+        int boardSize;
+        uint64_t stopAfter;
+    };
+    const Case cases[] = {{5, 1}, {8, 1}, {8, 3}, {9, 1}, {9, 3}, {9, 7}};
+    const std::string solverTypes[] = {"BT", "BT-BITS", "BT-FC", "BT-FC-DVO", "AC3", "AC3-DVO"};
+    const std::string symmetries[] = {"NONE", "MIRROR", "FUNDAMENTAL"};
+
+    int failures = 0;
+    for (const auto &solverType : solverTypes)
+    {
+        for (const auto &symmetry : symmetries)
+        {
+            for (bool parallel : {false, true})
+            {
+                for (const auto &test : cases)
+                {
+                    Config config{};
+                    config.solverType = solverType;
+                    config.boardSize = test.boardSize;
+                    config.symmetry = symmetry;
+                    config.stopAfter = test.stopAfter;
+                    config.isParallel = parallel;
+                    config.nThreads = parallel ? 3 : 1;
+                    config.domainGranularity = 2;
+
+                    // the runner's own output would bury the results
+                    std::ostringstream discarded;
+                    std::streambuf *original = std::cout.rdbuf(discarded.rdbuf());
+                    ExperimentResult result = runExperiment(config);
+                    std::cout.rdbuf(original);
+
+                    bool ok = result.numberOfSolutions == test.stopAfter &&
+                              (symmetry != "FUNDAMENTAL" || result.numberOfFundamental > 0);
+                    if (!ok)
+                    {
+                        std::cout << "FAILED " << solverType << " " << symmetry << (parallel ? " parallel" : "")
+                                  << " N = " << test.boardSize << ", k = " << test.stopAfter << ": "
+                                  << result.numberOfSolutions << " solutions, " << result.numberOfFundamental
+                                  << " fundamental\n";
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << (failures == 0 ? "first k OK\n" : "first k FAILED\n");
+    return failures == 0 ? 0 : 1;
+}
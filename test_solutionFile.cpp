@@ -0,0 +1,86 @@
+#include "SolutionFile.h"
+#include "BTBitsSolver.h"
+#include "Symmetry.h"
+
+#include <iostream>
+#include <cstdio>
+#include <string>
+
+static int failures = 0;
+
+static void check(bool ok, const std::string &what)
+{
+    if (!ok)
+    {
+        std::cout << "FAILED: " << what << "\n";
+        failures++;
+    }
+}
+
+// writes every solution of a board to a solution file, maps it back in and checks it holds the same boards in the
+// same order, with mirrored the writer adds every board's mirror image right after it
+static void roundTrip(int boardSize, bool mirrored)
+{
+    std::string name = "N = " + std::to_string(boardSize) + (mirrored ? " mirrored" : "");
+    std::string path = "test_solutionFile-" + std::to_string(boardSize) + ".nqs";
+
+    BTBitsSolver<Bitset<1>> solver(boardSize, Solution(boardSize, -1));
+    solver.solve();
+    const std::vector<Solution> &solutions = solver.getSolutions();
+
+    {
+        SolutionFileWriter writer(path, boardSize, mirrored);
+        check(writer.good(), name + ": writer opens " + path);
+
+        // a small batch so the file is written in several chunks
+        SolutionBatch batch(&writer, boardSize, 7);
+        for (const Solution &solution : solutions)
+            batch.add(solution);
+        batch.flush();
+
+        writer.close();
+        check(writer.good(), name + ": writer closes " + path);
+    }
+
+    SolutionFileReader reader;
+    check(reader.open(path), name + ": reader maps " + path);
+    check(reader.verify(), name + ": every record is a valid board");
+    check(reader.boardSize() == boardSize, name + ": board size");
+
+    uint64_t copies = mirrored ? 2 : 1;
+    check(reader.size() == solutions.size() * copies, name + ": " + std::to_string(reader.size()) + " records for " +
+                                                          std::to_string(solutions.size() * copies) + " solutions");
+
+    for (uint64_t i = 0; i < reader.size() && i / copies < solutions.size(); i++)
+    {
+        const Solution &expected = i % copies == 0 ? solutions[i / copies] : mirrorSolution(solutions[i / copies]);
+        if (reader.get(i) != expected)
+        {
+            check(false, name + ": record " + std::to_string(i) + " differs");
+            break;
+        }
+    }
+
+    reader.close();
+    std::remove(path.c_str());
+}
+
+// returns 0 if every check passed
+int main()
+{
+    // 1 bit up to 5 bits per row, and rows that straddle bytes
+    const int boardSizes[] = {1, 4, 5, 8, 9, 10, 12};
+
+    for (const auto &size : boardSizes)
+    {
+        roundTrip(size, false);
+        roundTrip(size, true);
+    }
+
+    // a path that can't be opened has to show up in good(), the runner relies on it
+    SolutionFileWriter broken("no-such-directory/solutions.nqs", 8);
+    check(!broken.good(), "writer reports a path it can't open");
+
+    std::cout << (failures == 0 ? "solution file round trip OK\n" : "solution file round trip FAILED\n");
+    return failures == 0 ? 0 : 1;
+}